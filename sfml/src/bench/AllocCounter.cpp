@@ -0,0 +1,70 @@
+#include "AllocCounter.hpp"
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+namespace {
+
+// Cada bloque lleva delante su tamano para poder descontarlo al liberarlo.
+constexpr std::size_t HEADER_SIZE = alignof(std::max_align_t);
+
+std::atomic<std::size_t> g_allocations{ 0 };
+std::atomic<std::size_t> g_bytes{ 0 };
+std::atomic<std::size_t> g_live{ 0 };
+std::atomic<std::size_t> g_peak{ 0 };
+
+void* countedAlloc(std::size_t size) {
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+    g_bytes.fetch_add(size, std::memory_order_relaxed);
+
+    std::size_t live = g_live.fetch_add(size, std::memory_order_relaxed) + size;
+    std::size_t peak = g_peak.load(std::memory_order_relaxed);
+    while (live > peak && !g_peak.compare_exchange_weak(peak, live, std::memory_order_relaxed)) {
+    }
+
+    void* block = std::malloc(size + HEADER_SIZE);
+    if (!block) {
+        throw std::bad_alloc();
+    }
+    *static_cast<std::size_t*>(block) = size;
+    return static_cast<char*>(block) + HEADER_SIZE;
+}
+
+void countedFree(void* p) {
+    if (!p) {
+        return;
+    }
+    void* block = static_cast<char*>(p) - HEADER_SIZE;
+    g_live.fetch_sub(*static_cast<std::size_t*>(block), std::memory_order_relaxed);
+    std::free(block);
+}
+
+}
+
+std::size_t allocationCount() {
+    return g_allocations.load(std::memory_order_relaxed);
+}
+
+std::size_t allocatedBytes() {
+    return g_bytes.load(std::memory_order_relaxed);
+}
+
+std::size_t liveBytes() {
+    return g_live.load(std::memory_order_relaxed);
+}
+
+std::size_t peakLiveBytes() {
+    return g_peak.load(std::memory_order_relaxed);
+}
+
+void resetPeakLiveBytes() {
+    g_peak.store(g_live.load(std::memory_order_relaxed), std::memory_order_relaxed);
+}
+
+void* operator new(std::size_t size) { return countedAlloc(size); }
+void* operator new[](std::size_t size) { return countedAlloc(size); }
+void operator delete(void* p) noexcept { countedFree(p); }
+void operator delete[](void* p) noexcept { countedFree(p); }
+void operator delete(void* p, std::size_t) noexcept { countedFree(p); }
+void operator delete[](void* p, std::size_t) noexcept { countedFree(p); }
@@ -0,0 +1,16 @@
+#ifndef ALLOCCOUNTER_HPP
+#define ALLOCCOUNTER_HPP
+
+#include <cstddef>
+
+// Contadores del operator new global reemplazado en AllocCounter.cpp.
+// Solo se enlaza en hexbench; el juego usa el allocador normal.
+std::size_t allocationCount();
+std::size_t allocatedBytes();
+
+// Bytes vivos en el heap y maximo alcanzado desde el ultimo resetPeakLiveBytes().
+std::size_t liveBytes();
+std::size_t peakLiveBytes();
+void resetPeakLiveBytes();
+
+#endif
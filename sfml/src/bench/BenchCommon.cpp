@@ -0,0 +1,35 @@
+#include "BenchCommon.hpp"
+#include <algorithm>
+#include <filesystem>
+#include <system_error>
+
+using namespace model;
+namespace fs = std::filesystem;
+
+Endpoints findEndpoints(const HexGrid& grid) {
+    Endpoints e;
+    for (int r = 0; r < grid.rows(); ++r) {
+        for (int c = 0; c < grid.cols(); ++c) {
+            if (grid.at(r, c).type == CellType::START) { e.startRow = r; e.startCol = c; }
+            if (grid.at(r, c).type == CellType::GOAL)  { e.goalRow = r;  e.goalCol = c; }
+        }
+    }
+    return e;
+}
+
+std::vector<std::string> listMapFiles(const std::string& resourcesDir) {
+    std::vector<std::string> maps;
+    // Sin excepciones: una carpeta que no se puede leer es una lista vacia.
+    std::error_code error;
+    for (const auto& entry : fs::directory_iterator(resourcesDir, error)) {
+        if (entry.is_regular_file(error) && entry.path().extension() == ".txt") {
+            maps.push_back(entry.path().string());
+        }
+    }
+    std::sort(maps.begin(), maps.end());
+    return maps;
+}
+
+std::string mapName(const std::string& path) {
+    return fs::path(path).filename().string();
+}
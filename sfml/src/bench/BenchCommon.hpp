@@ -0,0 +1,37 @@
+#ifndef BENCHCOMMON_HPP
+#define BENCHCOMMON_HPP
+
+#include "model/HexGrid.hpp"
+#include <string>
+#include <vector>
+
+struct Endpoints {
+    int startRow = -1, startCol = -1;
+    int goalRow = -1, goalCol = -1;
+
+    bool valid() const { return startRow >= 0 && goalRow >= 0; }
+};
+
+Endpoints findEndpoints(const model::HexGrid& grid);
+
+// Mapas .txt de la carpeta indicada, en orden alfabetico.
+std::vector<std::string> listMapFiles(const std::string& resourcesDir);
+
+// Nombre del archivo sin la carpeta, para las tablas de resultados.
+std::string mapName(const std::string& path);
+
+int runPathBenchmark(const std::string& resourcesDir);
+int runReplanBenchmark(const std::string& resourcesDir);
+int runNeighborBenchmark(const std::string& resourcesDir);
+int runFieldBenchmark(const std::string& resourcesDir);
+
+struct SuiteOptions {
+    int maxSize = 2048;                       // lado maximo de los mapas generados
+    std::string solver;                       // vacio = todos los motores
+    std::string csvPath = "hexbench_suite.csv";
+    std::string jsonPath;                     // vacio = sin JSON
+};
+
+int runSuiteBenchmark(const std::string& resourcesDir, const SuiteOptions& options);
+
+#endif
@@ -0,0 +1,69 @@
+#include "BenchCommon.hpp"
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+#include <string>
+
+static int usage() {
+    std::cerr << "Uso: hexbench [path|replan|neighbors|field] [carpeta de mapas]\n"
+              << "     hexbench suite [carpeta de mapas] [--max N] [--motor nombre]"
+                 " [--csv archivo] [--json archivo]\n";
+    return 1;
+}
+
+int main(int argc, char* argv[]) {
+    std::string mode = argc > 1 ? argv[1] : "path";
+    std::string resourcesDir = "resources";
+
+    int next = 2;
+    if (argc > next && std::strncmp(argv[next], "--", 2) != 0) {
+        resourcesDir = argv[next++];
+    }
+
+    if (!std::filesystem::is_directory(resourcesDir)) {
+        std::cerr << "No existe la carpeta de mapas: " << resourcesDir << "\n";
+        return usage();
+    }
+
+    if (mode == "path") {
+        return runPathBenchmark(resourcesDir);
+    }
+    if (mode == "replan") {
+        return runReplanBenchmark(resourcesDir);
+    }
+    if (mode == "neighbors") {
+        return runNeighborBenchmark(resourcesDir);
+    }
+    if (mode == "field") {
+        return runFieldBenchmark(resourcesDir);
+    }
+    if (mode == "suite") {
+        SuiteOptions options;
+        for (; next < argc; ++next) {
+            std::string arg = argv[next];
+            if (next + 1 >= argc) {
+                return usage();
+            }
+            if (arg == "--max") {
+                char* end = nullptr;
+                long value = std::strtol(argv[++next], &end, 10);
+                if (*end != '\0' || value < 1 || value > 1 << 16) {
+                    return usage();
+                }
+                options.maxSize = static_cast<int>(value);
+            } else if (arg == "--motor") {
+                options.solver = argv[++next];
+            } else if (arg == "--csv") {
+                options.csvPath = argv[++next];
+            } else if (arg == "--json") {
+                options.jsonPath = argv[++next];
+            } else {
+                return usage();
+            }
+        }
+        return runSuiteBenchmark(resourcesDir, options);
+    }
+
+    return usage();
+}
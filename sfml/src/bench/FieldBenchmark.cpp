@@ -0,0 +1,138 @@
+#include "BenchCommon.hpp"
+#include "MapGenerator.hpp"
+#include "core/AStarSearch.hpp"
+#include "core/DistanceField.hpp"
+#include "model/HexGrid.hpp"
+#include "model/Player.hpp"
+#include "utils/MapLoader.hpp"
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace model;
+
+namespace {
+
+constexpr int QUERIES_PER_MAP = 200;
+
+struct Query {
+    int row, col, energy;
+};
+
+struct FieldTotals {
+    int queries = 0;
+    int mismatches = 0;      // consultas en las que un motor encuentra camino y el otro no
+    double astarUs = 0.0;
+    double fieldUs = 0.0;
+    double firstUs = 0.0;    // primera consulta del campo, la que mas expande
+    std::size_t expanded = 0;
+};
+
+template <typename Fn>
+double timeUs(Fn&& fn) {
+    auto begin = std::chrono::steady_clock::now();
+    fn();
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - begin).count();
+}
+
+// La salida del mapa y despues posiciones al azar sobre celdas transitables,
+// como las del jugador a lo largo de una partida.
+std::vector<Query> randomQueries(const HexGrid& grid, const Endpoints& e, std::uint32_t seed) {
+    std::mt19937 rng(seed);
+    std::vector<Query> queries;
+    queries.push_back(Query{ e.startRow, e.startCol, 0 });
+
+    for (int attempt = 0; attempt < QUERIES_PER_MAP * 64 && static_cast<int>(queries.size()) < QUERIES_PER_MAP; ++attempt) {
+        int r = static_cast<int>(rng() % grid.rows());
+        int c = static_cast<int>(rng() % grid.cols());
+        CellType type = grid.at(r, c).type;
+        if (type == CellType::EMPTY || type == CellType::START) {
+            queries.push_back(Query{ r, c, static_cast<int>(rng() % (Player::MAX_ENERGY + 1)) });
+        }
+    }
+    return queries;
+}
+
+// Todas las consultas sobre el mismo grid, sin cambios entre ellas: A* busca
+// cada una desde cero y el campo se construye una vez y se extiende si hace falta.
+FieldTotals measure(HexGrid& grid, const Endpoints& e, std::uint32_t seed) {
+    FieldTotals totals;
+    std::vector<Query> queries = randomQueries(grid, e, seed);
+
+    core::AStarSearch search;
+    core::DistanceField field;
+
+    for (std::size_t i = 0; i < queries.size(); ++i) {
+        const Query& q = queries[i];
+
+        PathfindingResult astar{ {}, false };
+        PathfindingResult fromField{ {}, false };
+        totals.astarUs += timeUs([&] {
+            search.begin(grid, q.row, q.col, e.goalRow, e.goalCol, q.energy);
+            search.run();
+            astar = search.result();
+        });
+
+        double us = timeUs([&] {
+            if (!field.builtFor(grid, e.goalRow, e.goalCol)) {
+                field.begin(grid, e.goalRow, e.goalCol);
+            }
+            if (field.extendTo(q.row, q.col, q.energy) == core::SearchStatus::Found) {
+                fromField = field.path(q.row, q.col, q.energy);
+            }
+        });
+        totals.fieldUs += us;
+        if (i == 0) {
+            totals.firstUs = us;
+        }
+
+        if (astar.success != fromField.success) {
+            ++totals.mismatches;
+        }
+        ++totals.queries;
+    }
+
+    totals.expanded = field.stats().expanded;
+    return totals;
+}
+
+void printRow(const std::string& name, const HexGrid& grid, const FieldTotals& t) {
+    std::string size = std::to_string(grid.rows()) + "x" + std::to_string(grid.cols());
+    std::printf("%-22s %9s %6d %12.1f %12.1f %12.1f %10zu %8.1fx %9d\n",
+                name.c_str(), size.c_str(), t.queries,
+                t.astarUs / t.queries, t.fieldUs / t.queries, t.firstUs / 1000.0,
+                t.expanded, t.fieldUs > 0.0 ? t.astarUs / t.fieldUs : 0.0, t.mismatches);
+}
+
+}
+
+int runFieldBenchmark(const std::string& resourcesDir) {
+    std::printf("%-22s %9s %6s %12s %12s %12s %10s %9s %9s\n",
+                "mapa", "tamano", "consul", "astar(us)", "campo(us)", "primera(ms)", "expandidos", "speedup", "difieren");
+
+    for (const auto& path : listMapFiles(resourcesDir)) {
+        HexGrid grid = loadHexGridFromFile(path);
+        Endpoints e = findEndpoints(grid);
+        if (!e.valid()) {
+            continue;
+        }
+        printRow(mapName(path), grid, measure(grid, e, 1234));
+    }
+
+    for (int size : { 128, 256 }) {
+        MapGenOptions options;
+        options.rows = size;
+        options.cols = size;
+        options.wallDensity = 0.25f;
+        options.conveyorDensity = 0.05f;
+        options.seed = static_cast<std::uint32_t>(size);
+
+        HexGrid grid = generateMap(options);
+        Endpoints e = findEndpoints(grid);
+        printRow("generado-" + std::to_string(size), grid, measure(grid, e, 1234));
+    }
+
+    return 0;
+}
@@ -0,0 +1,259 @@
+#include "LegacyRender.hpp"
+#include "MapGenerator.hpp"
+#include "RenderBench.hpp"
+#include "core/GameLogic.hpp"
+#include "core/PathFinding.hpp"
+#include "model/Player.hpp"
+#include "render/BoardDetail.hpp"
+#include "render/BoardRenderer.hpp"
+#include "render/Camera.hpp"
+#include "render/CellPalette.hpp"
+#include "render/GridMesh.hpp"
+#include "render/HexLayout.hpp"
+#include "render/HexRenderer.hpp"
+#include "utils/Utils.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace model;
+using namespace sf;
+
+// drawGrid original contra el tablero por capas, en un RenderTexture del tamano
+// de la ventana del juego, con el camino a la meta visible. La ultima columna cambia una celda por frame, como
+// una pared nueva o rota, para ver que el costo sigue a las celdas cambiadas.
+// Los mapas que no caben en la ventana se ven con la camara siguiendo al
+// jugador, mientras que el original los encoge y dibuja entero.
+int runGridRenderBenchmark(const RenderBenchOptions& options) {
+    Font font;
+    if (!font.loadFromFile(options.resourcesDir + "/arial.ttf")) {
+        std::fprintf(stderr, "No se pudo cargar la fuente de %s\n", options.resourcesDir.c_str());
+        return 1;
+    }
+
+    RenderTexture target;
+    if (!target.create(1400, 900)) {
+        std::fprintf(stderr, "No se pudo crear el RenderTexture\n");
+        return 1;
+    }
+
+    struct Case { const char* name; int size; };
+    const Case cases[] = { { "40x40", 40 }, { "100x100", 100 }, { "200x200", 200 } };
+
+    std::printf("%-10s %12s %12s %9s %14s %10s\n",
+                "mapa", "legacy(ms)", "capas(ms)", "speedup", "1 cambio(ms)", "redibujo");
+
+    for (const Case& c : cases) {
+        MapGenOptions gen;
+        gen.rows = c.size;
+        gen.cols = c.size;
+        gen.wallDensity = 0.2f;
+        gen.conveyorDensity = 0.1f;
+        HexGrid grid = generateMap(gen);
+
+        std::optional<HexCell> start = findStartCell(grid);
+        Player player(start->row, start->col);
+
+        Text text = createText(font, 16, Color::White);
+        CircleShape hexagon = createHexagon();
+        BoardRenderer board;
+        Camera camera;
+        Clock animClock, bgClock;
+        // Con el camino a la meta visible, como tras pulsar P.
+        std::optional<HexCell> goal = findGoalCell(grid);
+        std::vector<std::pair<int, int>> pathCells;
+        for (const HexCell& cell : findPath(grid, start->row, start->col, goal->row, goal->col, 0).path) {
+            pathCells.emplace_back(cell.row, cell.col);
+        }
+
+        double legacyMs = timeFrames(target, options.frames, [&] {
+            drawGridLegacy(target, grid, player, hexagon, text, font, animClock, bgClock, pathCells);
+        });
+        double layeredMs = timeFrames(target, options.frames, [&] {
+            drawGrid(target, grid, player, board, camera, font, animClock, bgClock, pathCells);
+        });
+
+        int row = c.size / 2, col = c.size / 2;
+        double changingMs = timeFrames(target, options.frames, [&] {
+            CellType current = grid.type(row, col);
+            grid.setType(row, col, current == CellType::WALL ? CellType::EMPTY : CellType::WALL);
+            drawGrid(target, grid, player, board, camera, font, animClock, bgClock, pathCells);
+        });
+
+        std::printf("%-10s %12.2f %12.2f %8.1fx %14.2f %10zu\n", c.name, legacyMs, layeredMs,
+                    legacyMs / layeredMs, changingMs, board.redrawnCells());
+    }
+
+    return 0;
+}
+
+// La camara recorre el mapa en diagonal a un tamano fijo. Con el recorte por
+// region el costo por frame depende de lo visible y no del tamano del mapa.
+int runCameraBenchmark(const RenderBenchOptions& options) {
+    Font font;
+    if (!font.loadFromFile(options.resourcesDir + "/arial.ttf")) {
+        std::fprintf(stderr, "No se pudo cargar la fuente de %s\n", options.resourcesDir.c_str());
+        return 1;
+    }
+
+    RenderTexture target;
+    if (!target.create(1400, 900)) {
+        std::fprintf(stderr, "No se pudo crear el RenderTexture\n");
+        return 1;
+    }
+
+    std::printf("%-10s %14s %12s %12s %10s\n", "mapa", "primer(ms)", "frame(ms)", "region", "rearmados");
+
+    const int sizes[] = { 100, 500, 1000, 2000 };
+    for (int size : sizes) {
+        MapGenOptions gen;
+        gen.rows = size;
+        gen.cols = size;
+        gen.wallDensity = 0.2f;
+        gen.conveyorDensity = 0.1f;
+        HexGrid grid = generateMap(gen);
+
+        std::optional<HexCell> start = findStartCell(grid);
+        Player player(start->row, start->col);
+        BoardRenderer board;
+        Camera camera;
+        Clock animClock, bgClock;
+        std::vector<std::pair<int, int>> pathCells;
+
+        auto begin = std::chrono::steady_clock::now();
+        target.clear();
+        drawGrid(target, grid, player, board, camera, font, animClock, bgClock, pathCells);
+        target.display();
+        target.getTexture().copyToImage();
+        double firstMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin).count();
+
+        std::size_t rebuildsBefore = board.regionRebuilds();
+        double frameMs = timeFrames(target, options.frames, [&] {
+            camera.pan(Vector2f(6.0f, 4.0f));
+            drawGrid(target, grid, player, board, camera, font, animClock, bgClock, pathCells);
+        });
+
+        const CellRange& region = board.region();
+        std::string name = std::to_string(size) + "x" + std::to_string(size);
+        std::string cells = std::to_string(region.rows()) + "x" + std::to_string(region.cols());
+        std::printf("%-10s %14.2f %12.2f %12s %10zu\n", name.c_str(), firstMs, frameMs, cells.c_str(),
+                    board.regionRebuilds() - rebuildsBefore);
+    }
+
+    return 0;
+}
+
+// Un mapa de 2000x2000 a varios niveles de zoom: que nivel de detalle toca,
+// cuantas celdas se ven, cuanto cuesta rearmar al cambiar el zoom y el frame
+// mientras la camara se desplaza.
+int runDetailBenchmark(const RenderBenchOptions& options) {
+    Font font;
+    if (!font.loadFromFile(options.resourcesDir + "/arial.ttf")) {
+        std::fprintf(stderr, "No se pudo cargar la fuente de %s\n", options.resourcesDir.c_str());
+        return 1;
+    }
+
+    RenderTexture target;
+    if (!target.create(1400, 900)) {
+        std::fprintf(stderr, "No se pudo crear el RenderTexture\n");
+        return 1;
+    }
+
+    MapGenOptions gen;
+    gen.rows = 2000;
+    gen.cols = 2000;
+    gen.wallDensity = 0.2f;
+    gen.conveyorDensity = 0.1f;
+    HexGrid grid = generateMap(gen);
+
+    std::optional<HexCell> start = findStartCell(grid);
+    Player player(start->row, start->col);
+    BoardRenderer board;
+    Camera camera;
+    Clock animClock, bgClock;
+    std::vector<std::pair<int, int>> pathCells;
+
+    std::printf("Niveles: texeles < %.0f px, rellenos < %.0f px, completo desde %.0f px\n\n",
+                TEXEL_DETAIL_BELOW, FULL_DETAIL_FROM, FULL_DETAIL_FROM);
+    std::printf("%-8s %-10s %12s %11s %11s\n", "hex(px)", "nivel", "visibles", "armar(ms)", "frame(ms)");
+
+    // El primer frame deja la camara siguiendo al jugador; despues se fija cada zoom.
+    drawGrid(target, grid, player, board, camera, font, animClock, bgClock, pathCells);
+
+    const float sizes[] = { 0.5f, 1.0f, 2.0f, 3.0f, 4.0f, 6.0f, 8.0f, 12.0f, 16.0f, 24.0f };
+    for (float size : sizes) {
+        camera.zoom(size / camera.hexSize());
+
+        auto begin = std::chrono::steady_clock::now();
+        target.clear();
+        drawGrid(target, grid, player, board, camera, font, animClock, bgClock, pathCells);
+        target.display();
+        target.getTexture().copyToImage();
+        double buildMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin).count();
+
+        double frameMs = timeFrames(target, options.frames, [&] {
+            camera.pan(Vector2f(3.0f, 2.0f));
+            drawGrid(target, grid, player, board, camera, font, animClock, bgClock, pathCells);
+        });
+
+        HexLayout layout = scaledLayout(camera.hexSize());
+        long long visible = static_cast<long long>(target.getSize().x / layout.spacingX + 1) *
+                            static_cast<long long>(target.getSize().y / layout.spacingY + 1);
+        std::printf("%-8.1f %-10s %12lld %11.2f %11.2f\n", size, detailName(board.detail()),
+                    std::min(visible, static_cast<long long>(grid.rows()) * grid.cols()), buildMs, frameMs);
+    }
+
+    return 0;
+}
+
+// Solo la parte de CPU que colorea los rellenos: getCellColor por celda (como
+// antes de CellPalette) contra una tabla por tipo copiada a los vertices.
+int runColorBenchmark(const RenderBenchOptions& options) {
+    std::printf("%-10s %16s %16s %9s\n", "mapa", "por celda(ms)", "paleta(ms)", "speedup");
+
+    const int sizes[] = { 200, 500, 1000 };
+    for (int size : sizes) {
+        MapGenOptions gen;
+        gen.rows = size;
+        gen.cols = size;
+        gen.wallDensity = 0.2f;
+        gen.conveyorDensity = 0.3f;
+        HexGrid grid = generateMap(gen);
+
+        HexLayout layout = fitLayout(Vector2u(1400, 900), grid.rows(), grid.cols());
+        GridMesh mesh;
+        mesh.rebuild(grid, layout, CellRange{ 0, grid.rows(), 0, grid.cols() });
+        VertexArray fills(Triangles, grid.types().size() * GridMesh::FILL_VERTICES);
+        Clock animClock;
+
+        auto begin = std::chrono::steady_clock::now();
+        for (int frame = 0; frame < options.frames; ++frame) {
+            const std::vector<CellType>& types = grid.types();
+            for (std::size_t i = 0; i < types.size(); ++i) {
+                Color color = getCellColor(types[i], animClock);
+                for (std::size_t v = i * GridMesh::FILL_VERTICES; v < (i + 1) * GridMesh::FILL_VERTICES; ++v) {
+                    fills[v].color = color;
+                }
+            }
+        }
+        auto middle = std::chrono::steady_clock::now();
+
+        CellPalette palette;
+        for (int frame = 0; frame < options.frames; ++frame) {
+            palette.update(animClock.getElapsedTime().asSeconds());
+            mesh.updateColors(grid, palette);
+        }
+        auto end = std::chrono::steady_clock::now();
+
+        double perCellMs = std::chrono::duration<double, std::milli>(middle - begin).count() / options.frames;
+        double paletteMs = std::chrono::duration<double, std::milli>(end - middle).count() / options.frames;
+        std::string name = std::to_string(size) + "x" + std::to_string(size);
+        std::printf("%-10s %16.3f %16.3f %8.1fx\n", name.c_str(), perCellMs, paletteMs, perCellMs / paletteMs);
+    }
+
+    return 0;
+}
@@ -0,0 +1,147 @@
+#include "LegacyPathFinding.hpp"
+#include "model/Player.hpp"
+#include <algorithm>
+#include <map>
+#include <queue>
+#include <set>
+#include <tuple>
+#include <vector>
+
+namespace {
+
+constexpr int MAX_ENERGY = model::Player::MAX_ENERGY;
+
+struct State {
+    int row, col;
+    int energy;
+    int cost;
+
+    bool operator>(const State& other) const {
+        return cost > other.cost;
+    }
+};
+
+}
+
+PathfindingResult findPathLegacy(
+    model::HexGrid& grid,
+    int startRow, int startCol,
+    int goalRow, int goalCol,
+    int initialEnergy
+) {
+    std::priority_queue<State, std::vector<State>, std::greater<State> > openSet;
+    std::map<std::tuple<int, int, int>, std::tuple<int, int, int> > cameFrom;
+    std::set<std::tuple<int, int, int> > visited;
+
+    int actualStartRow = startRow;
+    int actualStartCol = startCol;
+    int actualStartEnergy = initialEnergy;
+    
+    if (grid.at(startRow, startCol).type != model::CellType::GOAL) {
+        auto startResult = slideThroughBands(grid, startRow, startCol, initialEnergy);
+        actualStartRow = std::get<0>(startResult);
+        actualStartCol = std::get<1>(startResult);
+        actualStartEnergy = std::get<2>(startResult);
+    }
+
+    openSet.push(State{actualStartRow, actualStartCol, actualStartEnergy, 0});
+    visited.insert(std::make_tuple(actualStartRow, actualStartCol, actualStartEnergy));
+
+    while (!openSet.empty()) {
+        State current = openSet.top();
+        openSet.pop();
+
+        model::HexCell cell = grid.at(current.row, current.col);
+        for (const model::HexCell& neighbor : grid.neighbors(cell)) {
+            int nr = neighbor.row;
+            int nc = neighbor.col;
+            int newEnergy = std::min(current.energy + 1, MAX_ENERGY);
+
+            if (neighbor.type == model::CellType::WALL) {
+                if (current.energy < MAX_ENERGY) {
+                    continue;
+                }
+                newEnergy = 0;
+            }
+
+            if (nr == goalRow && nc == goalCol && neighbor.type == model::CellType::GOAL) {
+                std::vector<std::pair<int, int> > keyPoints;
+                std::tuple<int, int, int> key = std::make_tuple(current.row, current.col, current.energy);
+                
+                while (cameFrom.count(key)) {
+                    std::tuple<int, int, int> prev = cameFrom[key];
+                    keyPoints.push_back(std::make_pair(std::get<0>(key), std::get<1>(key)));
+                    key = prev;
+                }
+                keyPoints.push_back(std::make_pair(actualStartRow, actualStartCol));
+                std::reverse(keyPoints.begin(), keyPoints.end());
+                
+                keyPoints.push_back(std::make_pair(nr, nc));
+                
+                std::vector<std::pair<int, int> > completePath = getStepByStepPath(grid, keyPoints, initialEnergy);
+                
+                std::vector<model::HexCell> path;
+                for (const auto& point : completePath) {
+                    path.push_back(grid.at(point.first, point.second));
+                }
+                
+                if (path.empty() || path.back().row != goalRow || path.back().col != goalCol) {
+                    path.push_back(grid.at(goalRow, goalCol));
+                }
+                
+                return PathfindingResult{path, true};
+            }
+
+            int finalR = nr;
+            int finalC = nc;
+            int finalEnergy = newEnergy;
+            
+            if (neighbor.type != model::CellType::GOAL) {
+                auto result = slideThroughBands(grid, nr, nc, newEnergy);
+                finalR = std::get<0>(result);
+                finalC = std::get<1>(result);
+                finalEnergy = std::get<2>(result);
+                
+                if (finalR == goalRow && finalC == goalCol) {
+                    std::vector<std::pair<int, int> > keyPoints;
+                    std::tuple<int, int, int> key = std::make_tuple(current.row, current.col, current.energy);
+                    
+                    while (cameFrom.count(key)) {
+                        std::tuple<int, int, int> prev = cameFrom[key];
+                        keyPoints.push_back(std::make_pair(std::get<0>(key), std::get<1>(key)));
+                        key = prev;
+                    }
+                    keyPoints.push_back(std::make_pair(actualStartRow, actualStartCol));
+                    std::reverse(keyPoints.begin(), keyPoints.end());
+                    
+                    keyPoints.push_back(std::make_pair(finalR, finalC));
+                    
+                    std::vector<std::pair<int, int> > completePath = getStepByStepPath(grid, keyPoints, initialEnergy);
+                    
+                    std::vector<model::HexCell> path;
+                    for (const auto& point : completePath) {
+                        path.push_back(grid.at(point.first, point.second));
+                    }
+                    
+                    if (path.empty() || path.back().row != goalRow || path.back().col != goalCol) {
+                        path.push_back(grid.at(goalRow, goalCol));
+                    }
+                    
+                    return PathfindingResult{path, true};
+                }
+            }
+           
+            std::tuple<int, int, int> key = std::make_tuple(finalR, finalC, finalEnergy);
+
+            if (visited.count(key)) {
+                continue;
+            }
+            visited.insert(key);
+
+            openSet.push(State{finalR, finalC, finalEnergy, current.cost + 1});
+            cameFrom[key] = std::make_tuple(current.row, current.col, current.energy);
+        }
+    }
+
+    return PathfindingResult{std::vector<model::HexCell>(), false};
+}
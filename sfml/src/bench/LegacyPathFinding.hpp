@@ -0,0 +1,16 @@
+#ifndef LEGACYPATHFINDING_HPP
+#define LEGACYPATHFINDING_HPP
+
+#include "core/PathFinding.hpp"
+#include "model/HexGrid.hpp"
+
+// Implementacion original con std::map/std::set. Solo se enlaza en hexbench,
+// como referencia para comparar contra core::AStarSearch.
+PathfindingResult findPathLegacy(
+    model::HexGrid& grid,
+    int startRow, int startCol,
+    int goalRow, int goalCol,
+    int initialEnergy
+);
+
+#endif
@@ -0,0 +1,23 @@
+#ifndef LEGACYRENDER_HPP
+#define LEGACYRENDER_HPP
+
+#include <SFML/Graphics.hpp>
+#include "model/HexGrid.hpp"
+#include "model/Player.hpp"
+#include <utility>
+#include <vector>
+
+// Implementaciones originales del render, una figura de SFML por elemento en
+// cada frame. Solo se enlazan en hexrenderbench, para comparar contra el
+// tablero por capas y los fondos en malla.
+
+void drawGridLegacy(sf::RenderTarget& window, const model::HexGrid& grid,
+    model::Player& player, sf::CircleShape& hexagon,
+    sf::Text& text, sf::Font& font, sf::Clock& animClock, sf::Clock& bgClock,
+    std::vector<std::pair<int, int>>& pathCells);
+
+void drawAnimatedBackgroundLegacy(sf::RenderTarget& window, sf::Clock& bgClock);
+
+void drawIntroBackgroundLegacy(sf::RenderTarget& window, float time);
+
+#endif
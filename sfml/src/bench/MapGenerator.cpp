@@ -0,0 +1,27 @@
+#include "MapGenerator.hpp"
+#include <random>
+
+using namespace model;
+
+HexGrid generateMap(const MapGenOptions& options) {
+    HexGrid grid(options.rows, options.cols);
+    std::mt19937 rng(options.seed);
+    std::uniform_real_distribution<float> roll(0.0f, 1.0f);
+    std::uniform_int_distribution<int> conveyor(static_cast<int>(CellType::UP_RIGHT),
+                                                static_cast<int>(CellType::DOWN_LEFT));
+
+    for (int r = 0; r < options.rows; ++r) {
+        for (int c = 0; c < options.cols; ++c) {
+            float value = roll(rng);
+            if (value < options.wallDensity) {
+                grid.setType(r, c, CellType::WALL);
+            } else if (value < options.wallDensity + options.conveyorDensity) {
+                grid.setType(r, c, static_cast<CellType>(conveyor(rng)));
+            }
+        }
+    }
+
+    grid.setType(0, 0, CellType::START);
+    grid.setType(options.rows - 1, options.cols - 1, CellType::GOAL);
+    return grid;
+}
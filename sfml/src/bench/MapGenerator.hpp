@@ -0,0 +1,18 @@
+#ifndef MAPGENERATOR_HPP
+#define MAPGENERATOR_HPP
+
+#include "model/HexGrid.hpp"
+#include <cstdint>
+
+struct MapGenOptions {
+    int rows = 64;
+    int cols = 64;
+    float wallDensity = 0.2f;
+    float conveyorDensity = 0.05f;
+    std::uint32_t seed = 1;
+};
+
+// Mapa aleatorio con START en la esquina superior izquierda y GOAL en la opuesta.
+model::HexGrid generateMap(const MapGenOptions& options);
+
+#endif
@@ -0,0 +1,98 @@
+#include "AllocCounter.hpp"
+#include "BenchCommon.hpp"
+#include "MapGenerator.hpp"
+#include "core/AStarSearch.hpp"
+#include "model/HexGrid.hpp"
+#include "utils/MapLoader.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+using namespace model;
+
+namespace {
+
+struct NeighborResult {
+    double nsPerCell = 0.0;
+    std::size_t allocations = 0;
+    long long checksum = 0;
+};
+
+// Recorre los vecinos de todas las celdas con la API de rango y cuenta allocs.
+NeighborResult scanNeighbors(const HexGrid& grid, int passes) {
+    NeighborResult r;
+    std::size_t before = allocationCount();
+    auto begin = std::chrono::steady_clock::now();
+
+    for (int pass = 0; pass < passes; ++pass) {
+        for (int row = 0; row < grid.rows(); ++row) {
+            for (int col = 0; col < grid.cols(); ++col) {
+                for (const HexCell& n : grid.neighbors(grid.at(row, col))) {
+                    r.checksum += n.row + static_cast<int>(n.type);
+                }
+            }
+        }
+    }
+
+    double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - begin).count();
+    r.allocations = allocationCount() - before;
+    r.nsPerCell = ns / (static_cast<double>(passes) * grid.rows() * grid.cols());
+    return r;
+}
+
+// Allocs de una busqueda A* ya "caliente": los buffers quedaron reservados
+// por la busqueda anterior, asi que run() no deberia pedir memoria.
+void searchAllocations(HexGrid& grid, const Endpoints& e, std::size_t& expanded, std::size_t& allocations) {
+    core::AStarSearch search;
+    search.begin(grid, e.startRow, e.startCol, e.goalRow, e.goalCol, 0);
+    search.run();
+
+    search.begin(grid, e.startRow, e.startCol, e.goalRow, e.goalCol, 0);
+    std::size_t before = allocationCount();
+    search.run();
+    allocations = allocationCount() - before;
+    expanded = search.stats().expanded;
+}
+
+void printRow(const std::string& name, HexGrid& grid) {
+    Endpoints e = findEndpoints(grid);
+    if (!e.valid()) {
+        return;
+    }
+
+    int passes = std::max(1, 2000000 / (grid.rows() * grid.cols()));
+    NeighborResult scan = scanNeighbors(grid, passes);
+
+    std::size_t expanded = 0, searchAllocs = 0;
+    searchAllocations(grid, e, expanded, searchAllocs);
+
+    std::string size = std::to_string(grid.rows()) + "x" + std::to_string(grid.cols());
+    std::printf("%-18s %9s %12.2f %12zu %10zu %12zu %14.3f\n",
+                name.c_str(), size.c_str(), scan.nsPerCell, scan.allocations,
+                expanded, searchAllocs,
+                expanded ? static_cast<double>(searchAllocs) / expanded : 0.0);
+}
+
+}
+
+int runNeighborBenchmark(const std::string& resourcesDir) {
+    std::printf("%-18s %9s %12s %12s %10s %12s %14s\n",
+                "mapa", "tamano", "ns/celda", "allocs-vecin", "expandidos", "allocs-A*", "allocs/expan");
+
+    for (const auto& path : listMapFiles(resourcesDir)) {
+        HexGrid grid = loadHexGridFromFile(path);
+        printRow(mapName(path), grid);
+    }
+
+    MapGenOptions options;
+    options.rows = 256;
+    options.cols = 256;
+    options.wallDensity = 0.25f;
+    options.conveyorDensity = 0.05f;
+    HexGrid generated = generateMap(options);
+    printRow("generado-256", generated);
+
+    return 0;
+}
@@ -0,0 +1,59 @@
+#include "BenchCommon.hpp"
+#include "LegacyPathFinding.hpp"
+#include "core/PathFinding.hpp"
+#include "model/HexGrid.hpp"
+#include "utils/MapLoader.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+using namespace model;
+
+typedef PathfindingResult (*PathFunction)(HexGrid&, int, int, int, int, int);
+
+// Repite la busqueda hasta acumular al menos ~200 ms y devuelve microsegundos por consulta.
+static double timeQuery(PathFunction fn, HexGrid& grid, const Endpoints& e, PathfindingResult& last) {
+    using clock = std::chrono::steady_clock;
+    int iterations = 0;
+    auto begin = clock::now();
+    auto elapsed = clock::duration::zero();
+
+    do {
+        last = fn(grid, e.startRow, e.startCol, e.goalRow, e.goalCol, 0);
+        ++iterations;
+        elapsed = clock::now() - begin;
+    } while (iterations < 5 || elapsed < std::chrono::milliseconds(200));
+
+    return std::chrono::duration<double, std::micro>(elapsed).count() / iterations;
+}
+
+int runPathBenchmark(const std::string& resourcesDir) {
+    std::vector<std::string> maps = listMapFiles(resourcesDir);
+
+    std::printf("%-18s %9s %12s %12s %8s %10s\n", "mapa", "tamano", "legacy(us)", "flat(us)", "speedup", "pasos");
+
+    for (const auto& path : maps) {
+        HexGrid grid = loadHexGridFromFile(path);
+        Endpoints e = findEndpoints(grid);
+        if (!e.valid()) {
+            continue;
+        }
+
+        PathfindingResult legacy, flat;
+        double legacyUs = timeQuery(findPathLegacy, grid, e, legacy);
+        double flatUs = timeQuery(findPath, grid, e, flat);
+
+        std::string size = std::to_string(grid.rows()) + "x" + std::to_string(grid.cols());
+        std::string steps = legacy.success == flat.success
+            ? std::to_string(legacy.path.size()) + "/" + std::to_string(flat.path.size())
+            : std::string("DIFIERE");
+
+        std::printf("%-18s %9s %12.1f %12.1f %7.1fx %10s\n",
+                    mapName(path).c_str(), size.c_str(),
+                    legacyUs, flatUs, legacyUs / flatUs, steps.c_str());
+    }
+
+    return 0;
+}
@@ -0,0 +1,43 @@
+#ifndef RENDERBENCH_HPP
+#define RENDERBENCH_HPP
+
+#include <SFML/Graphics.hpp>
+#include <chrono>
+#include <string>
+
+// Benchmarks de render sin ventana: todo se dibuja en un sf::RenderTexture.
+struct RenderBenchOptions {
+    std::string resourcesDir = "resources";
+    int frames = 120;
+};
+
+// Milisegundos por frame de drawFrame sobre target.
+template <typename DrawFrame>
+double timeFrames(sf::RenderTexture& target, int frames, DrawFrame&& drawFrame)
+{
+    // Un frame de calentamiento para que texturas y glifos ya esten creados.
+    target.clear();
+    drawFrame();
+    target.display();
+    target.getTexture().copyToImage();
+
+    auto begin = std::chrono::steady_clock::now();
+    for (int i = 0; i < frames; ++i) {
+        target.clear();
+        drawFrame();
+        target.display();
+    }
+    // copyToImage espera a que la GPU termine todo lo encolado.
+    target.getTexture().copyToImage();
+
+    double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin).count();
+    return ms / frames;
+}
+
+int runGridRenderBenchmark(const RenderBenchOptions& options);
+int runCameraBenchmark(const RenderBenchOptions& options);
+int runColorBenchmark(const RenderBenchOptions& options);
+int runDetailBenchmark(const RenderBenchOptions& options);
+int runScreenBenchmark(const RenderBenchOptions& options);
+
+#endif
@@ -0,0 +1,34 @@
+#include "RenderBench.hpp"
+#include <iostream>
+#include <string>
+
+int main(int argc, char* argv[]) {
+    std::string mode = argc > 1 ? argv[1] : "grid";
+
+    RenderBenchOptions options;
+    if (argc > 2) {
+        options.resourcesDir = argv[2];
+    }
+    if (argc > 3) {
+        options.frames = std::stoi(argv[3]);
+    }
+
+    if (mode == "grid") {
+        return runGridRenderBenchmark(options);
+    }
+    if (mode == "camera") {
+        return runCameraBenchmark(options);
+    }
+    if (mode == "colors") {
+        return runColorBenchmark(options);
+    }
+    if (mode == "lod") {
+        return runDetailBenchmark(options);
+    }
+    if (mode == "screens") {
+        return runScreenBenchmark(options);
+    }
+
+    std::cerr << "Uso: hexrenderbench [grid|camera|colors|lod|screens] [carpeta de recursos] [frames]\n";
+    return 1;
+}
@@ -0,0 +1,142 @@
+#include "BenchCommon.hpp"
+#include "MapGenerator.hpp"
+#include "core/AStarSearch.hpp"
+#include "core/IncrementalPlanner.hpp"
+#include "core/PathFinding.hpp"
+#include "model/HexGrid.hpp"
+#include "utils/MapLoader.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <tuple>
+#include <vector>
+
+using namespace model;
+
+namespace {
+
+constexpr int MOVES_PER_RUN = 300;
+constexpr int TURNS_PER_WALL = 5;
+constexpr int MAX_ENERGY = 10;
+
+struct ReplayTotals {
+    int plans = 0;
+    int moves = 0;
+    int walls = 0;
+    int mismatches = 0;      // planes en los que D* Lite y A* no coinciden en exito o movimientos
+    double incrementalUs = 0.0;
+    double fullUs = 0.0;
+};
+
+template <typename Fn>
+double timeUs(Fn&& fn) {
+    auto begin = std::chrono::steady_clock::now();
+    fn();
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - begin).count();
+}
+
+// Reproduce una partida larga: el jugador sigue el camino planificado, cada
+// TURNS_PER_WALL movimientos aparece una pared aleatoria y se replanifica.
+// Cada consulta se resuelve con el planificador incremental y desde cero, y
+// se cuentan las que no coinciden en exito o en movimientos. El largo en
+// celdas no sirve: dos caminos minimos pueden pasar por bandas distintas.
+ReplayTotals replay(HexGrid& grid, const Endpoints& e, std::uint32_t seed) {
+    ReplayTotals totals;
+    std::mt19937 rng(seed);
+    core::IncrementalPlanner planner;
+    core::AStarSearch search;
+
+    int row = e.startRow, col = e.startCol, energy = 0;
+
+    while (totals.moves < MOVES_PER_RUN) {
+        PathfindingResult incremental, full;
+        totals.incrementalUs += timeUs([&] {
+            incremental = planner.plan(grid, row, col, e.goalRow, e.goalCol, energy);
+        });
+        totals.fullUs += timeUs([&] {
+            search.begin(grid, row, col, e.goalRow, e.goalCol, energy);
+            search.run();
+            full = search.result();
+        });
+        ++totals.plans;
+
+        if (incremental.success != full.success || planner.stats().moves != search.stats().moves) {
+            ++totals.mismatches;
+        }
+
+        if (!incremental.success || incremental.path.size() < 2) {
+            break;
+        }
+
+        HexCell next = incremental.path[1];
+        if (next.type == CellType::WALL) {
+            grid.setType(next.row, next.col, CellType::EMPTY);
+            energy = 0;
+        } else {
+            energy = std::min(energy + 1, MAX_ENERGY);
+        }
+        std::tie(row, col, energy) = slideThroughBands(grid, next.row, next.col, energy);
+        ++totals.moves;
+
+        if (row == e.goalRow && col == e.goalCol) {
+            row = e.startRow;
+            col = e.startCol;
+            energy = 0;
+        }
+
+        if (totals.moves % TURNS_PER_WALL == 0) {
+            for (int attempt = 0; attempt < 64; ++attempt) {
+                int r = static_cast<int>(rng() % grid.rows());
+                int c = static_cast<int>(rng() % grid.cols());
+                if (grid.at(r, c).type == CellType::EMPTY && !(r == row && c == col)) {
+                    grid.setType(r, c, CellType::WALL);
+                    ++totals.walls;
+                    break;
+                }
+            }
+        }
+    }
+
+    return totals;
+}
+
+void printRow(const std::string& name, const HexGrid& grid, const ReplayTotals& t) {
+    std::string size = std::to_string(grid.rows()) + "x" + std::to_string(grid.cols());
+    std::printf("%-22s %9s %6d %6d %6d %14.1f %14.1f %8.1fx %9d\n",
+                name.c_str(), size.c_str(), t.plans, t.moves, t.walls,
+                t.fullUs / 1000.0, t.incrementalUs / 1000.0,
+                t.incrementalUs > 0.0 ? t.fullUs / t.incrementalUs : 0.0, t.mismatches);
+}
+
+}
+
+int runReplanBenchmark(const std::string& resourcesDir) {
+    std::printf("%-22s %9s %6s %6s %6s %14s %14s %9s %9s\n",
+                "mapa", "tamano", "planes", "movs", "paredes", "completo(ms)", "incremental(ms)", "speedup", "difieren");
+
+    for (const auto& path : listMapFiles(resourcesDir)) {
+        HexGrid grid = loadHexGridFromFile(path);
+        Endpoints e = findEndpoints(grid);
+        if (!e.valid()) {
+            continue;
+        }
+        printRow(mapName(path), grid, replay(grid, e, 1234));
+    }
+
+    for (int size : { 128, 256 }) {
+        MapGenOptions options;
+        options.rows = size;
+        options.cols = size;
+        options.wallDensity = 0.25f;
+        options.conveyorDensity = 0.05f;
+        options.seed = static_cast<std::uint32_t>(size);
+
+        HexGrid grid = generateMap(options);
+        Endpoints e = findEndpoints(grid);
+        printRow("generado-" + std::to_string(size), grid, replay(grid, e, 1234));
+    }
+
+    return 0;
+}
@@ -0,0 +1,90 @@
+#include "LegacyRender.hpp"
+#include "MapGenerator.hpp"
+#include "RenderBench.hpp"
+#include "core/GameLogic.hpp"
+#include "model/Player.hpp"
+#include "render/BoardRenderer.hpp"
+#include "render/Camera.hpp"
+#include "render/HexRenderer.hpp"
+#include "render/IntroScreen.hpp"
+#include "render/ScreenRenderer.hpp"
+#include "utils/Utils.hpp"
+#include <cstdio>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace model;
+using namespace sf;
+
+// Intro y pantalla de juego a resoluciones de monitor hasta 4K. El fondo se mide
+// solo (original contra malla) y despues la pantalla completa: en la de juego el
+// original es drawGridLegacy, que tambien usa el fondo original.
+int runScreenBenchmark(const RenderBenchOptions& options) {
+    Font font;
+    if (!font.loadFromFile(options.resourcesDir + "/arial.ttf")) {
+        std::fprintf(stderr, "No se pudo cargar la fuente de %s\n", options.resourcesDir.c_str());
+        return 1;
+    }
+
+    MapGenOptions gen;
+    gen.rows = 40;
+    gen.cols = 40;
+    gen.wallDensity = 0.2f;
+    gen.conveyorDensity = 0.1f;
+    HexGrid grid = generateMap(gen);
+    std::optional<HexCell> start = findStartCell(grid);
+    Player player(start->row, start->col);
+    std::vector<std::pair<int, int>> pathCells;
+
+    struct Size { const char* name; unsigned width; unsigned height; };
+    const Size sizes[] = { { "1080p", 1920, 1080 }, { "1440p", 2560, 1440 }, { "4K", 3840, 2160 } };
+
+    std::printf("%-8s %-7s %16s %12s %9s %17s %14s\n",
+                "pantalla", "tamano", "fondo legacy(ms)", "fondo(ms)", "speedup", "completa leg.(ms)", "completa(ms)");
+
+    for (const Size& s : sizes) {
+        RenderTexture target;
+        if (!target.create(s.width, s.height)) {
+            std::fprintf(stderr, "No se pudo crear el RenderTexture de %ux%u\n", s.width, s.height);
+            return 1;
+        }
+
+        Clock clock;
+        double introLegacyMs = timeFrames(target, options.frames, [&] {
+            drawIntroBackgroundLegacy(target, clock.getElapsedTime().asSeconds());
+        });
+        double introMs = timeFrames(target, options.frames, [&] {
+            drawIntroBackground(target, clock.getElapsedTime().asSeconds());
+        });
+        double introFullMs = timeFrames(target, options.frames, [&] {
+            mostrarIntro(target, font);
+        });
+        std::printf("%-8s %-7s %16.2f %12.2f %8.1fx %17s %14.2f\n", "intro", s.name,
+                    introLegacyMs, introMs, introLegacyMs / introMs, "-", introFullMs);
+
+        Clock animClock, bgClock;
+        double gameLegacyMs = timeFrames(target, options.frames, [&] {
+            drawAnimatedBackgroundLegacy(target, bgClock);
+        });
+        double gameMs = timeFrames(target, options.frames, [&] {
+            drawAnimatedBackground(target, bgClock);
+        });
+
+        Text text = createText(font, 16, Color::White);
+        CircleShape hexagon = createHexagon();
+        BoardRenderer board;
+        Camera camera;
+        double gameFullLegacyMs = timeFrames(target, options.frames, [&] {
+            drawGridLegacy(target, grid, player, hexagon, text, font, animClock, bgClock, pathCells);
+        });
+        double gameFullMs = timeFrames(target, options.frames, [&] {
+            drawGrid(target, grid, player, board, camera, font, animClock, bgClock, pathCells);
+        });
+        std::printf("%-8s %-7s %16.2f %12.2f %8.1fx %17.2f %14.2f\n", "juego", s.name,
+                    gameLegacyMs, gameMs, gameLegacyMs / gameMs, gameFullLegacyMs, gameFullMs);
+    }
+
+    return 0;
+}
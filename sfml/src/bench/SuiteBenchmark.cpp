@@ -0,0 +1,321 @@
+#include "AllocCounter.hpp"
+#include "BenchCommon.hpp"
+#include "LegacyPathFinding.hpp"
+#include "MapGenerator.hpp"
+#include "core/AStarSearch.hpp"
+#include "core/DistanceField.hpp"
+#include "core/IncrementalPlanner.hpp"
+#include "core/PathFinding.hpp"
+#include "model/HexGrid.hpp"
+#include "model/Player.hpp"
+#include "utils/MapLoader.hpp"
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace model;
+
+namespace {
+
+struct SolveResult {
+    bool success = false;
+    std::size_t pathCells = 0;
+    long long expanded = -1;   // -1: el motor no cuenta nodos
+};
+
+class BenchSolver {
+public:
+    virtual ~BenchSolver() = default;
+    virtual SolveResult solve(HexGrid& grid, const Endpoints& e, int energy) = 0;
+};
+
+// Mismo motor que findPath, usado directamente para leer sus estadisticas.
+class AStarSolver : public BenchSolver {
+public:
+    SolveResult solve(HexGrid& grid, const Endpoints& e, int energy) override {
+        m_search.begin(grid, e.startRow, e.startCol, e.goalRow, e.goalCol, energy);
+        m_search.run();
+        PathfindingResult result = m_search.result();
+        return { result.success, result.path.size(), static_cast<long long>(m_search.stats().expanded) };
+    }
+
+private:
+    core::AStarSearch m_search;
+};
+
+// Planificacion completa de D* Lite: reset() descarta g/rhs pero conserva la memoria.
+class IncrementalSolver : public BenchSolver {
+public:
+    SolveResult solve(HexGrid& grid, const Endpoints& e, int energy) override {
+        m_planner.reset();
+        PathfindingResult result = m_planner.plan(grid, e.startRow, e.startCol, e.goalRow, e.goalCol, energy);
+        return { result.success, result.path.size(), static_cast<long long>(m_planner.stats().expanded) };
+    }
+
+private:
+    core::IncrementalPlanner m_planner;
+};
+
+// Campo de distancias desde la meta construido para una sola consulta; su
+// ventaja es reutilizarlo, eso se mide en `hexbench field`.
+class FieldSolver : public BenchSolver {
+public:
+    SolveResult solve(HexGrid& grid, const Endpoints& e, int energy) override {
+        m_field.begin(grid, e.goalRow, e.goalCol);
+        PathfindingResult result{ {}, false };
+        if (m_field.extendTo(e.startRow, e.startCol, energy) == core::SearchStatus::Found) {
+            result = m_field.path(e.startRow, e.startCol, energy);
+        }
+        return { result.success, result.path.size(), static_cast<long long>(m_field.stats().expanded) };
+    }
+
+private:
+    core::DistanceField m_field;
+};
+
+class LegacySolver : public BenchSolver {
+public:
+    SolveResult solve(HexGrid& grid, const Endpoints& e, int energy) override {
+        PathfindingResult result = findPathLegacy(grid, e.startRow, e.startCol, e.goalRow, e.goalCol, energy);
+        return { result.success, result.path.size(), -1 };
+    }
+};
+
+template <typename T>
+std::unique_ptr<BenchSolver> makeSolver() {
+    return std::make_unique<T>();
+}
+
+struct SolverEntry {
+    const char* name;
+    std::size_t maxCells;   // mapas con mas celdas se saltan; 0 = sin limite
+    std::unique_ptr<BenchSolver> (*create)();
+};
+
+// Para medir un motor nuevo basta con agregarlo aqui.
+const SolverEntry SOLVERS[] = {
+    { "astar",       0,         &makeSolver<AStarSolver> },
+    { "incremental", 0,         &makeSolver<IncrementalSolver> },
+    { "field",       0,         &makeSolver<FieldSolver> },
+    { "legacy",      128 * 128, &makeSolver<LegacySolver> },
+};
+
+struct Profile {
+    const char* name;
+    float wallDensity;
+    float conveyorDensity;
+    int energy;
+};
+
+const Profile PROFILES[] = {
+    { "abierto", 0.10f, 0.02f, 0 },
+    { "paredes", 0.30f, 0.02f, 0 },
+    { "bandas",  0.10f, 0.25f, 0 },
+    { "energia", 0.30f, 0.05f, Player::MAX_ENERGY },
+};
+
+const int GENERATED_SIZES[] = { 32, 64, 128, 256, 512, 1024, 2048 };
+
+struct BenchCase {
+    std::string name;
+    HexGrid grid;
+    int energy = 0;
+};
+
+struct Row {
+    std::string map;
+    int rows = 0;
+    int cols = 0;
+    double wallDensity = 0.0;
+    double conveyorDensity = 0.0;
+    int energy = 0;
+    std::string solver;
+    SolveResult result;
+    double coldUs = 0.0;
+    double warmUs = 0.0;
+    int iterations = 0;
+    std::size_t peakBytes = 0;
+    std::size_t coldAllocations = 0;
+    double warmAllocations = 0.0;
+};
+
+BenchCase generatedCase(int size, const Profile& profile) {
+    MapGenOptions gen;
+    gen.rows = size;
+    gen.cols = size;
+    gen.wallDensity = profile.wallDensity;
+    gen.conveyorDensity = profile.conveyorDensity;
+    gen.seed = static_cast<std::uint32_t>(size * 31 + (&profile - PROFILES));
+
+    return BenchCase{ std::string(profile.name) + "-" + std::to_string(size), generateMap(gen), profile.energy };
+}
+
+// Fraccion real de paredes y bandas, tambien para los mapas de resources/.
+void measureDensities(const HexGrid& grid, double& walls, double& conveyors) {
+    std::size_t wallCount = 0, conveyorCount = 0;
+    for (CellType type : grid.types()) {
+        if (type == CellType::WALL) {
+            ++wallCount;
+        } else if (isConveyor(type)) {
+            ++conveyorCount;
+        }
+    }
+    double cells = static_cast<double>(grid.rows()) * grid.cols();
+    walls = wallCount / cells;
+    conveyors = conveyorCount / cells;
+}
+
+// Primera consulta con un motor recien creado (memoria y allocations en frio) y
+// despues consultas repetidas sobre el mismo motor hasta acumular ~200 ms.
+Row measure(const SolverEntry& entry, BenchCase& bench, const Endpoints& e) {
+    using clock = std::chrono::steady_clock;
+
+    Row row;
+    row.solver = entry.name;
+
+    std::size_t liveBefore = liveBytes();
+    std::size_t allocsBefore = allocationCount();
+    resetPeakLiveBytes();
+
+    auto begin = clock::now();
+    std::unique_ptr<BenchSolver> solver = entry.create();
+    row.result = solver->solve(bench.grid, e, bench.energy);
+    row.coldUs = std::chrono::duration<double, std::micro>(clock::now() - begin).count();
+
+    row.peakBytes = peakLiveBytes() - liveBefore;
+    row.coldAllocations = allocationCount() - allocsBefore;
+
+    allocsBefore = allocationCount();
+    begin = clock::now();
+    auto elapsed = clock::duration::zero();
+    do {
+        solver->solve(bench.grid, e, bench.energy);
+        ++row.iterations;
+        elapsed = clock::now() - begin;
+    } while ((row.iterations < 3 && elapsed < std::chrono::seconds(2)) ||
+             elapsed < std::chrono::milliseconds(200));
+
+    row.warmUs = std::chrono::duration<double, std::micro>(elapsed).count() / row.iterations;
+    row.warmAllocations = static_cast<double>(allocationCount() - allocsBefore) / row.iterations;
+    return row;
+}
+
+void writeCsv(const std::string& path, const std::vector<Row>& rows) {
+    std::ofstream out(path);
+    out << "mapa,filas,columnas,paredes,bandas,energia,motor,exito,celdas_camino,expandidos,"
+           "us_frio,us_consulta,iteraciones,pico_bytes,allocs_frio,allocs_consulta\n";
+    char buffer[512];
+    for (const Row& r : rows) {
+        std::snprintf(buffer, sizeof(buffer),
+                      "%s,%d,%d,%.4f,%.4f,%d,%s,%d,%zu,%lld,%.1f,%.1f,%d,%zu,%zu,%.1f\n",
+                      r.map.c_str(), r.rows, r.cols, r.wallDensity, r.conveyorDensity, r.energy,
+                      r.solver.c_str(), r.result.success ? 1 : 0, r.result.pathCells, r.result.expanded,
+                      r.coldUs, r.warmUs, r.iterations, r.peakBytes, r.coldAllocations, r.warmAllocations);
+        out << buffer;
+    }
+}
+
+void writeJson(const std::string& path, const std::vector<Row>& rows) {
+    std::ofstream out(path);
+    out << "[\n";
+    char buffer[768];
+    for (std::size_t i = 0; i < rows.size(); ++i) {
+        const Row& r = rows[i];
+        std::snprintf(buffer, sizeof(buffer),
+                      "  {\"mapa\": \"%s\", \"filas\": %d, \"columnas\": %d, \"paredes\": %.4f, "
+                      "\"bandas\": %.4f, \"energia\": %d, \"motor\": \"%s\", \"exito\": %s, "
+                      "\"celdas_camino\": %zu, \"expandidos\": %lld, \"us_frio\": %.1f, "
+                      "\"us_consulta\": %.1f, \"iteraciones\": %d, \"pico_bytes\": %zu, "
+                      "\"allocs_frio\": %zu, \"allocs_consulta\": %.1f}%s\n",
+                      r.map.c_str(), r.rows, r.cols, r.wallDensity, r.conveyorDensity, r.energy,
+                      r.solver.c_str(), r.result.success ? "true" : "false", r.result.pathCells,
+                      r.result.expanded, r.coldUs, r.warmUs, r.iterations, r.peakBytes,
+                      r.coldAllocations, r.warmAllocations, i + 1 < rows.size() ? "," : "");
+        out << buffer;
+    }
+    out << "]\n";
+}
+
+}
+
+int runSuiteBenchmark(const std::string& resourcesDir, const SuiteOptions& options) {
+    std::vector<const SolverEntry*> solvers;
+    for (const SolverEntry& entry : SOLVERS) {
+        if (options.solver.empty() || options.solver == entry.name) {
+            solvers.push_back(&entry);
+        }
+    }
+    if (solvers.empty()) {
+        std::fprintf(stderr, "Motor desconocido: %s\n", options.solver.c_str());
+        return 1;
+    }
+
+    // Los mapas se generan de uno en uno: un 2048x2048 ya ocupa varios cientos de MB al resolverse.
+    std::vector<std::string> maps = listMapFiles(resourcesDir);
+    std::size_t shipped = maps.size();
+    std::vector<std::pair<int, const Profile*>> generated;
+    for (int size : GENERATED_SIZES) {
+        if (size > options.maxSize) {
+            continue;
+        }
+        for (const Profile& profile : PROFILES) {
+            generated.push_back({ size, &profile });
+        }
+    }
+
+    std::printf("%-22s %9s %-12s %6s %10s %9s %11s %10s %8s\n",
+                "mapa", "tamano", "motor", "pasos", "expandidos", "frio(ms)", "consulta(us)", "pico(KB)", "allocs");
+
+    std::vector<Row> rows;
+    for (std::size_t i = 0; i < shipped + generated.size(); ++i) {
+        BenchCase bench = i < shipped
+            ? BenchCase{ mapName(maps[i]), loadHexGridFromFile(maps[i]), 0 }
+            : generatedCase(generated[i - shipped].first, *generated[i - shipped].second);
+
+        Endpoints e = findEndpoints(bench.grid);
+        if (!e.valid()) {
+            continue;
+        }
+
+        double walls = 0.0, conveyors = 0.0;
+        measureDensities(bench.grid, walls, conveyors);
+        std::size_t cells = static_cast<std::size_t>(bench.grid.rows()) * bench.grid.cols();
+        std::string size = std::to_string(bench.grid.rows()) + "x" + std::to_string(bench.grid.cols());
+
+        for (const SolverEntry* entry : solvers) {
+            if (entry->maxCells != 0 && cells > entry->maxCells) {
+                continue;
+            }
+
+            Row row = measure(*entry, bench, e);
+            row.map = bench.name;
+            row.rows = bench.grid.rows();
+            row.cols = bench.grid.cols();
+            row.wallDensity = walls;
+            row.conveyorDensity = conveyors;
+            row.energy = bench.energy;
+
+            std::string steps = row.result.success ? std::to_string(row.result.pathCells) : std::string("-");
+            std::string expanded = row.result.expanded >= 0 ? std::to_string(row.result.expanded) : std::string("-");
+            std::printf("%-22s %9s %-12s %6s %10s %9.2f %11.1f %10zu %8.1f\n",
+                        row.map.c_str(), size.c_str(), row.solver.c_str(), steps.c_str(), expanded.c_str(),
+                        row.coldUs / 1000.0, row.warmUs, row.peakBytes / 1024, row.warmAllocations);
+            std::fflush(stdout);
+
+            rows.push_back(std::move(row));
+        }
+    }
+
+    if (!options.csvPath.empty()) {
+        writeCsv(options.csvPath, rows);
+        std::printf("\nResultados en %s\n", options.csvPath.c_str());
+    }
+    if (!options.jsonPath.empty()) {
+        writeJson(options.jsonPath, rows);
+        std::printf("Resultados en %s\n", options.jsonPath.c_str());
+    }
+    return 0;
+}
@@ -0,0 +1,259 @@
+#include "AStarSearch.hpp"
+#include <algorithm>
+#include <cstdlib>
+#include <tuple>
+
+using namespace model;
+
+namespace core {
+
+namespace {
+
+// Coordenadas cubicas para el layout "odd-r" (filas impares desplazadas a la derecha).
+struct Cube
+{
+    int x, y, z;
+};
+
+Cube toCube(int row, int col)
+{
+    int x = col - (row - (row & 1)) / 2;
+    int z = row;
+    return Cube{ x, -x - z, z };
+}
+
+int hexDistance(const Cube& a, const Cube& b)
+{
+    return std::max({ std::abs(a.x - b.x), std::abs(a.y - b.y), std::abs(a.z - b.z) });
+}
+
+}
+
+bool AStarSearch::openAfter(const OpenEntry& a, const OpenEntry& b)
+{
+    // Monticulo minimo por f; a igual f se prefiere el de mayor g (mas cerca de la meta).
+    return a.f > b.f || (a.f == b.f && a.g < b.g);
+}
+
+int AStarSearch::heuristic(int cell) const
+{
+    int row = cell / m_cols;
+    int col = cell % m_cols;
+    int distance = hexDistance(toCube(row, col), toCube(m_goalRow, m_goalCol));
+
+    // Un movimiento avanza una celda mas lo que recorra la banda; dividir por
+    // ese maximo mantiene la heuristica admisible y consistente.
+    int reach = 1 + m_maxSlide;
+    return (distance + reach - 1) / reach;
+}
+
+void AStarSearch::push(int state, int g, int parent)
+{
+    m_stamp[state] = m_generation;
+    m_cost[state] = g;
+    m_parent[state] = parent;
+
+    int cell = state / ENERGY_LEVELS;
+    m_open.push_back(OpenEntry{ g + heuristic(cell), g, state });
+    std::push_heap(m_open.begin(), m_open.end(), openAfter);
+    ++m_stats.generated;
+}
+
+void AStarSearch::begin(HexGrid& grid,
+                        int startRow, int startCol,
+                        int goalRow, int goalCol,
+                        int initialEnergy)
+{
+    m_grid = &grid;
+    m_cols = grid.cols();
+    m_goalRow = goalRow;
+    m_goalCol = goalCol;
+    m_goalCell = goalRow * m_cols + goalCol;
+    m_initialEnergy = initialEnergy;
+    m_goalParent = -1;
+    m_bestState = -1;
+    m_stats = SearchStats{};
+    m_open.clear();
+
+    std::size_t stateCount = static_cast<std::size_t>(grid.rows()) * grid.cols() * ENERGY_LEVELS;
+    if (m_stamp.size() < stateCount) {
+        m_stamp.assign(stateCount, 0);
+        m_parent.resize(stateCount);
+        m_cost.resize(stateCount);
+        m_generation = 0;
+    }
+
+    if (m_generation >= std::numeric_limits<std::uint32_t>::max() - 2) {
+        std::fill(m_stamp.begin(), m_stamp.end(), 0);
+        m_generation = 0;
+    }
+    m_generation += 2;
+
+    m_conveyors = &grid.conveyors();
+    m_maxSlide = m_conveyors->maxSlide();
+
+    int actualRow = startRow;
+    int actualCol = startCol;
+    int actualEnergy = initialEnergy;
+    if (grid.at(startRow, startCol).type != CellType::GOAL) {
+        std::tie(actualRow, actualCol, actualEnergy) = slideThroughBands(grid, startRow, startCol, initialEnergy);
+    }
+
+    m_startCell = actualRow * m_cols + actualCol;
+    m_status = SearchStatus::InProgress;
+    push(stateIndex(m_startCell, std::min(actualEnergy, MAX_ENERGY)), 0, -1);
+}
+
+SearchStatus AStarSearch::run(std::size_t maxExpansions)
+{
+    if (m_status != SearchStatus::InProgress) {
+        return m_status;
+    }
+
+    const HexGrid& grid = *m_grid;
+    const std::vector<CellType>& types = grid.types();
+    std::size_t expandedNow = 0;
+
+    while (!m_open.empty()) {
+        if (expandedNow >= maxExpansions) {
+            return m_status;
+        }
+
+        std::pop_heap(m_open.begin(), m_open.end(), openAfter);
+        OpenEntry current = m_open.back();
+        m_open.pop_back();
+
+        // Entradas obsoletas: el estado ya se cerro o se encontro un costo menor.
+        if (isClosed(current.state) || current.g != m_cost[current.state]) {
+            continue;
+        }
+        m_stamp[current.state] = m_generation + 1;
+        ++m_stats.expanded;
+        ++expandedNow;
+
+        int cell = current.state / ENERGY_LEVELS;
+        int energy = current.state % ENERGY_LEVELS;
+
+        int distance = hexDistance(toCube(cell / m_cols, cell % m_cols), toCube(m_goalRow, m_goalCol));
+        if (m_bestState < 0 || distance < m_bestDistance) {
+            m_bestState = current.state;
+            m_bestDistance = distance;
+        }
+
+        bool reachedGoal = false;
+
+        grid.forEachNeighbor(cell, [&](int neighbor) {
+            if (reachedGoal) {
+                return;
+            }
+
+            int finalCell = neighbor;
+            int finalEnergy = std::min(energy + 1, MAX_ENERGY);
+
+            if (types[neighbor] == CellType::WALL) {
+                if (energy < MAX_ENERGY) {
+                    return;
+                }
+                finalEnergy = 0;
+            }
+            else if (types[neighbor] != CellType::GOAL) {
+                ConveyorJump jump = m_conveyors->jump(neighbor);
+                finalCell = jump.target;
+                finalEnergy = std::min(finalEnergy + jump.gain, MAX_ENERGY);
+            }
+
+            if (finalCell == m_goalCell) {
+                reachedGoal = true;
+                return;
+            }
+
+            int next = stateIndex(finalCell, finalEnergy);
+            int g = current.g + 1;
+            if (isOpenOrClosed(next) && (isClosed(next) || m_cost[next] <= g)) {
+                return;
+            }
+            push(next, g, current.state);
+        });
+
+        if (reachedGoal) {
+            m_goalParent = current.state;
+            m_stats.moves = current.g + 1;
+            m_status = SearchStatus::Found;
+            return m_status;
+        }
+    }
+
+    m_status = SearchStatus::Unreachable;
+    return m_status;
+}
+
+SearchStatus AStarSearch::runFor(std::chrono::microseconds budget)
+{
+    auto deadline = std::chrono::steady_clock::now() + budget;
+    while (run(TIME_CHECK_EXPANSIONS) == SearchStatus::InProgress) {
+        if (std::chrono::steady_clock::now() >= deadline) {
+            break;
+        }
+    }
+    return m_status;
+}
+
+PathfindingResult AStarSearch::result() const
+{
+    if (m_status != SearchStatus::Found) {
+        return PathfindingResult{ std::vector<HexCell>(), false };
+    }
+
+    std::vector<HexCell> path = pathTo(m_goalParent);
+    if (path.empty() || path.back().row != m_goalRow || path.back().col != m_goalCol) {
+        path.push_back(m_grid->at(m_goalRow, m_goalCol));
+    }
+
+    return PathfindingResult{ path, true };
+}
+
+PathfindingResult AStarSearch::partialResult() const
+{
+    if (m_status == SearchStatus::Found) {
+        return result();
+    }
+    if (m_bestState < 0) {
+        return PathfindingResult{ std::vector<HexCell>(), false };
+    }
+
+    return PathfindingResult{ pathTo(m_bestState), false };
+}
+
+std::vector<std::pair<int, int> > AStarSearch::keyPointsTo(int lastState) const
+{
+    std::vector<std::pair<int, int> > keyPoints;
+    for (int state = lastState; m_parent[state] != -1; state = m_parent[state]) {
+        int cell = state / ENERGY_LEVELS;
+        keyPoints.emplace_back(cell / m_cols, cell % m_cols);
+    }
+    keyPoints.emplace_back(m_startCell / m_cols, m_startCell % m_cols);
+    std::reverse(keyPoints.begin(), keyPoints.end());
+    return keyPoints;
+}
+
+// Celdas desde el inicio hasta `lastState`, con los tramos de banda intermedios.
+std::vector<HexCell> AStarSearch::pathTo(int lastState) const
+{
+    HexGrid& grid = *m_grid;
+
+    std::vector<std::pair<int, int> > keyPoints = keyPointsTo(lastState);
+    if (lastState == m_goalParent && m_status == SearchStatus::Found) {
+        keyPoints.emplace_back(m_goalRow, m_goalCol);
+    }
+
+    std::vector<std::pair<int, int> > completePath = getStepByStepPath(grid, keyPoints, m_initialEnergy);
+
+    std::vector<HexCell> path;
+    path.reserve(completePath.size() + 1);
+    for (const auto& point : completePath) {
+        path.push_back(grid.at(point.first, point.second));
+    }
+    return path;
+}
+
+}
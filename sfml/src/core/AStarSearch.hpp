@@ -0,0 +1,108 @@
+#ifndef ASTARSEARCH_HPP
+#define ASTARSEARCH_HPP
+
+#include "../model/HexGrid.hpp"
+#include "../model/Player.hpp"
+#include "PathFinding.hpp"
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace core {
+
+enum class SearchStatus
+{
+    InProgress,
+    Found,
+    Unreachable,
+};
+
+struct SearchStats
+{
+    std::size_t expanded = 0;
+    std::size_t generated = 0;
+    int moves = -1;             // movimientos del camino encontrado, -1 si no hay
+};
+
+/**
+ * @brief Motor A* sobre estados (fila, columna, energia) indexados en arreglos planos.
+ *
+ * Cada estado se indexa como (row * cols + col) * (MAX_ENERGY + 1) + energy.
+ * Los arreglos de padre/costo/cerrado se reservan una sola vez y se reutilizan
+ * entre busquedas; un contador de generacion evita tener que limpiarlos.
+ */
+class AStarSearch
+{
+public:
+    static constexpr int MAX_ENERGY = model::Player::MAX_ENERGY;
+    static constexpr int ENERGY_LEVELS = MAX_ENERGY + 1;
+    static constexpr std::size_t TIME_CHECK_EXPANSIONS = 256;
+
+    void begin(model::HexGrid& grid,
+               int startRow, int startCol,
+               int goalRow, int goalCol,
+               int initialEnergy);
+
+    SearchStatus run(std::size_t maxExpansions = std::numeric_limits<std::size_t>::max());
+
+    // Como run, pero se detiene al agotar `budget`; el reloj se consulta cada
+    // TIME_CHECK_EXPANSIONS expansiones. Se puede seguir llamando frame a frame.
+    SearchStatus runFor(std::chrono::microseconds budget);
+
+    PathfindingResult result() const;
+
+    // Camino hasta el estado expandido mas cercano a la meta, mientras la busqueda sigue en curso.
+    PathfindingResult partialResult() const;
+
+    SearchStatus status() const { return m_status; }
+    const SearchStats& stats() const { return m_stats; }
+
+private:
+    struct OpenEntry
+    {
+        int f;
+        int g;
+        int state;
+    };
+
+    static bool openAfter(const OpenEntry& a, const OpenEntry& b);
+
+    std::vector<std::pair<int, int> > keyPointsTo(int lastState) const;
+    std::vector<model::HexCell> pathTo(int lastState) const;
+
+    int stateIndex(int cell, int energy) const { return cell * ENERGY_LEVELS + energy; }
+    int heuristic(int cell) const;
+    void push(int state, int g, int parent);
+    bool isOpenOrClosed(int state) const { return m_stamp[state] >= m_generation; }
+    bool isClosed(int state) const { return m_stamp[state] == m_generation + 1; }
+
+    model::HexGrid* m_grid = nullptr;
+    const model::ConveyorTable* m_conveyors = nullptr;
+    int m_cols = 0;
+    int m_goalCell = -1;
+    int m_goalRow = 0;
+    int m_goalCol = 0;
+    int m_startCell = -1;
+    int m_initialEnergy = 0;
+    int m_maxSlide = 0;
+
+    // Generacion actual en pasos de 2: stamp == gen -> abierto, stamp == gen + 1 -> cerrado.
+    std::uint32_t m_generation = 0;
+    std::vector<std::uint32_t> m_stamp;
+    std::vector<int> m_parent;
+    std::vector<int> m_cost;
+    std::vector<OpenEntry> m_open;
+
+    int m_goalParent = -1;
+    int m_bestState = -1;
+    int m_bestDistance = 0;
+    SearchStatus m_status = SearchStatus::Unreachable;
+    SearchStats m_stats;
+};
+
+}
+
+#endif
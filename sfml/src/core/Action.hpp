@@ -0,0 +1,35 @@
+#ifndef ACTION_HPP
+#define ACTION_HPP
+
+#include "Direction.hpp"
+#include <cstdint>
+
+namespace core {
+
+/**
+ * @brief Una jugada del usuario, independiente del teclado.
+ *
+ * Move avanza en una direccion (o rompe la pared en esa direccion si se
+ * esta eligiendo pared); ToggleWallSelect entra o sale del modo de romper
+ * pared; Cancel sale de ese modo.
+ */
+struct Action
+{
+    enum class Type : std::uint8_t
+    {
+        Move,
+        ToggleWallSelect,
+        Cancel,
+    };
+
+    Type type = Type::Move;
+    Direction direction = Direction::Right;
+
+    static Action move(Direction direction) { return Action{ Type::Move, direction }; }
+    static Action toggleWallSelect() { return Action{ Type::ToggleWallSelect, Direction::Right }; }
+    static Action cancel() { return Action{ Type::Cancel, Direction::Right }; }
+};
+
+}
+
+#endif
@@ -0,0 +1,157 @@
+#include "AsyncSolver.hpp"
+#include "DistanceField.hpp"
+#include <utility>
+
+using namespace model;
+
+namespace core {
+
+AsyncSolver::AsyncSolver()
+    : m_worker(&AsyncSolver::workerLoop, this)
+{
+}
+
+AsyncSolver::~AsyncSolver()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+        m_latest = 0;
+    }
+    m_wake.notify_one();
+    m_worker.join();
+}
+
+void AsyncSolver::request(const HexGrid& grid,
+                          int startRow, int startCol,
+                          int goalRow, int goalCol,
+                          int initialEnergy)
+{
+    m_active = ++m_nextId;
+    m_requestSource = &grid;
+    m_requestVersion = grid.version();
+    m_requestRow = startRow;
+    m_requestCol = startCol;
+    m_requestEnergy = initialEnergy;
+    m_requestKey = PathCache::keyFor(grid, startRow, startCol, goalRow, goalCol, initialEnergy);
+
+    // Un acierto se entrega en el proximo poll() sin despertar al hilo; la
+    // busqueda anterior, si seguia, se abandona igual que con una solicitud nueva.
+    if (const PathfindingResult* cached = PathCache::local().find(m_requestKey)) {
+        m_cached = *cached;
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_latest = m_active;
+        m_job.reset();
+        m_done.reset();
+        return;
+    }
+    m_cached.reset();
+
+    // El hilo puede seguir leyendo la copia anterior, asi que un grid distinto va en una copia nueva.
+    if (!m_snapshot || m_snapshotSource != &grid || m_snapshotVersion != grid.version() ||
+        m_snapshot->rows() != grid.rows() || m_snapshot->cols() != grid.cols()) {
+        m_snapshot = std::make_shared<HexGrid>(grid);
+        m_snapshotSource = &grid;
+        m_snapshotVersion = grid.version();
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_latest = m_active;
+        m_job = Job{ m_active, m_snapshot, startRow, startCol, goalRow, goalCol, initialEnergy };
+        m_done.reset();
+    }
+    m_wake.notify_one();
+}
+
+void AsyncSolver::cancel()
+{
+    m_active = 0;
+    m_cached.reset();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_latest = 0;
+    m_job.reset();
+    m_done.reset();
+}
+
+bool AsyncSolver::isStale(const HexGrid& grid, int row, int col, int energy) const
+{
+    return m_active != 0 &&
+        (m_requestSource != &grid || m_requestVersion != grid.version() ||
+         m_requestRow != row || m_requestCol != col || m_requestEnergy != energy);
+}
+
+std::optional<PathfindingResult> AsyncSolver::poll()
+{
+    if (m_active == 0) {
+        return std::nullopt;
+    }
+
+    if (m_cached) {
+        PathfindingResult result = std::move(*m_cached);
+        m_cached.reset();
+        m_active = 0;
+        return result;
+    }
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    if (!m_done || m_done->id != m_active) {
+        return std::nullopt;
+    }
+
+    PathfindingResult result = std::move(m_done->result);
+    m_done.reset();
+    lock.unlock();
+
+    m_active = 0;
+    PathCache::local().store(m_requestKey, result);
+    return result;
+}
+
+void AsyncSolver::workerLoop()
+{
+    // Un campo de distancias por copia del grid: mientras la copia no cambie,
+    // las solicitudes siguientes (P, R, recalculos) lo reutilizan o lo extienden.
+    DistanceField field;
+    std::shared_ptr<HexGrid> fieldGrid;
+
+    while (true) {
+        Job job;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_wake.wait(lock, [this] { return m_stop || m_job.has_value(); });
+            if (m_stop) {
+                return;
+            }
+            job = std::move(*m_job);
+            m_job.reset();
+        }
+
+        // La copia que se guarda aqui no se libera, asi que comparar punteros basta.
+        if (fieldGrid != job.grid || !field.builtFor(*job.grid, job.goalRow, job.goalCol)) {
+            field.begin(*job.grid, job.goalRow, job.goalCol);
+            fieldGrid = job.grid;
+        }
+
+        // Si se cancela, lo expandido queda en el campo para la proxima solicitud.
+        SearchStatus status = field.extendTo(job.startRow, job.startCol, job.initialEnergy, EXPANSIONS_PER_CHECK);
+        while (status == SearchStatus::InProgress && m_latest == job.id) {
+            status = field.extendTo(job.startRow, job.startCol, job.initialEnergy, EXPANSIONS_PER_CHECK);
+        }
+        if (status == SearchStatus::InProgress) {
+            continue;
+        }
+
+        PathfindingResult result = status == SearchStatus::Found
+            ? field.path(job.startRow, job.startCol, job.initialEnergy)
+            : PathfindingResult{ std::vector<HexCell>(), false };
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_latest == job.id) {
+            m_done = Done{ job.id, std::move(result) };
+        }
+    }
+}
+
+}
@@ -0,0 +1,106 @@
+#ifndef ASYNCSOLVER_HPP
+#define ASYNCSOLVER_HPP
+
+#include "../model/HexGrid.hpp"
+#include "PathCache.hpp"
+#include "PathFinding.hpp"
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+
+namespace core {
+
+/**
+ * @brief Busca caminos en un hilo propio para no congelar la ventana.
+ *
+ * request() copia el grid (solo si cambio desde la solicitud anterior) y
+ * deja la busqueda al hilo; poll(), llamado cada frame, devuelve el
+ * resultado una vez cuando esta listo. Solo vale la ultima solicitud: una
+ * nueva, cancel() o el destructor hacen que la busqueda en curso se abandone
+ * en el siguiente bloque de expansiones.
+ *
+ * El hilo responde desde un DistanceField de la copia actual, asi que las
+ * solicitudes repetidas sobre el mismo grid no vuelven a buscar desde cero.
+ * Antes de eso request() consulta la PathCache del hilo del juego, y poll()
+ * guarda ahi cada resultado del hilo.
+ *
+ * Todos los metodos publicos son para el hilo del juego.
+ */
+class AsyncSolver
+{
+public:
+    // Expansiones del campo de distancias entre comprobaciones de cancelacion.
+    static constexpr std::size_t EXPANSIONS_PER_CHECK = 4096;
+
+    AsyncSolver();
+    ~AsyncSolver();
+
+    AsyncSolver(const AsyncSolver&) = delete;
+    AsyncSolver& operator=(const AsyncSolver&) = delete;
+
+    void request(const model::HexGrid& grid,
+                 int startRow, int startCol,
+                 int goalRow, int goalCol,
+                 int initialEnergy);
+
+    void cancel();
+
+    // Hay una solicitud sin resultado entregado.
+    bool busy() const { return m_active != 0; }
+
+    // La solicitud pendiente se hizo con otro grid o desde otro estado del jugador.
+    bool isStale(const model::HexGrid& grid, int row, int col, int energy) const;
+
+    std::optional<PathfindingResult> poll();
+
+private:
+    struct Job
+    {
+        std::uint64_t id;
+        std::shared_ptr<model::HexGrid> grid;
+        int startRow, startCol;
+        int goalRow, goalCol;
+        int initialEnergy;
+    };
+
+    struct Done
+    {
+        std::uint64_t id;
+        PathfindingResult result;
+    };
+
+    void workerLoop();
+
+    // Solo del hilo del juego.
+    std::shared_ptr<model::HexGrid> m_snapshot;
+    const model::HexGrid* m_snapshotSource = nullptr;
+    unsigned long long m_snapshotVersion = 0;
+    std::uint64_t m_nextId = 0;
+    std::uint64_t m_active = 0;
+    const model::HexGrid* m_requestSource = nullptr;
+    unsigned long long m_requestVersion = 0;
+    int m_requestRow = -1;
+    int m_requestCol = -1;
+    int m_requestEnergy = -1;
+    PathKey m_requestKey{};
+    std::optional<PathfindingResult> m_cached;
+
+    // Compartido con el hilo de busqueda.
+    std::mutex m_mutex;
+    std::condition_variable m_wake;
+    std::optional<Job> m_job;
+    std::optional<Done> m_done;
+    std::atomic<std::uint64_t> m_latest{ 0 };
+    bool m_stop = false;
+
+    std::thread m_worker;
+};
+
+}
+
+#endif
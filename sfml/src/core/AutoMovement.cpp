@@ -2,22 +2,16 @@
 #include "../core/TurnSystem.hpp"
 #include "../core/GameLogic.hpp"
 #include "../core/PathFinding.hpp"
-#include <SFML/Window.hpp>
+#include "Direction.hpp"
+#include <cstdlib>
 
 using namespace model;
-using namespace sf;
 
 namespace core {
 
-static Keyboard::Key keyFromDelta(int dRow, int dCol, int curRow) {
-    bool odd = (curRow % 2) != 0;
-    if (dRow == -1 && dCol == (odd ? 0 : -1)) return Keyboard::W;
-    if (dRow == -1 && dCol == (odd ? 1 : 0)) return Keyboard::E;
-    if (dRow ==  0 && dCol == -1)              return Keyboard::A;
-    if (dRow ==  0 && dCol ==  1)              return Keyboard::D;
-    if (dRow ==  1 && dCol == (odd ? 1 : 0))   return Keyboard::X;
-    if (dRow ==  1 && dCol == (odd ? 0 : -1))  return Keyboard::Z;
-    return Keyboard::A;
+// Los pasos del camino son vecinos; si no lo fueran se intenta ir a la derecha, como antes.
+static Direction directionTo(int dRow, int dCol, int curRow) {
+    return directionFromDelta(dRow, dCol, curRow).value_or(Direction::Right);
 }
 
 bool recalculatePathInAutoMovement(
@@ -27,12 +21,12 @@ bool recalculatePathInAutoMovement(
     int goalRow,
     int goalCol
 ) {
-    PathfindingResult newPath = findPath(grid, player.row, player.col, goalRow, goalCol, player.energy);
+    PathfindingResult newPath = findPathCached(grid, player.row, player.col, goalRow, goalCol, player.energy);
     
     if (newPath.success && !newPath.path.empty()) {
         pathCells.clear();
-        for (auto* cell : newPath.path) {
-            pathCells.emplace_back(cell->row, cell->col);
+        for (const auto& cell : newPath.path) {
+            pathCells.emplace_back(cell.row, cell.col);
         }
         return true;
     }
@@ -42,6 +36,7 @@ bool recalculatePathInAutoMovement(
 void updateAutoMovement(
     HexGrid& grid,
     Player& player,
+    TurnSystem& turns,
     std::vector<std::pair<int,int>>& pathCells,
     int goalRow,
     int goalCol
@@ -68,14 +63,12 @@ void updateAutoMovement(
     }
 
     if (currentIndex >= static_cast<int>(pathCells.size())) {
-        HexCell* goalCell = &grid.at(goalRow, goalCol);
-        if (player.row == goalRow && player.col == goalCol && goalCell->type == CellType::GOAL) {
+        if (player.row == goalRow && player.col == goalCol && grid.type(goalRow, goalCol) == CellType::GOAL) {
             player.isAutoMoving = false;
             
             if (!player.hasWon) {
                 if (grid.at(player.row, player.col).type == CellType::GOAL) {
-                    player.hasWon = true;
-                    player.winTime = player.winClock.getElapsedTime().asSeconds();
+                    player.win();
                 }
             }
         } else {
@@ -90,9 +83,9 @@ void updateAutoMovement(
     if (nextR == goalRow && nextC == goalCol && grid.at(nextR, nextC).type == CellType::GOAL) {
         int dR = nextR - player.row;
         int dC = nextC - player.col;
-        Keyboard::Key dir = keyFromDelta(dR, dC, player.row);
+        Direction dir = directionTo(dR, dC, player.row);
         
-        handlePlayerMovement(dir, player, grid);
+        handlePlayerMovement(dir, player, grid, turns);
         
         if (player.hasWon) {
             player.isAutoMoving = false;
@@ -112,13 +105,14 @@ void updateAutoMovement(
 
     if (grid.at(nextR, nextC).type == CellType::WALL) {
         if (player.energy >= TurnSystem::ENERGY_PER_WALL_BREAK) {
-            grid.at(nextR, nextC).type = CellType::EMPTY;
+            grid.setType(nextR, nextC, CellType::EMPTY);
+            turns.onCellChanged(grid, nextR, nextC);
             player.energy -= TurnSystem::ENERGY_PER_WALL_BREAK;
             
             int dR = nextR - player.row;
             int dC = nextC - player.col;
-            Keyboard::Key dir = keyFromDelta(dR, dC, player.row);
-            handlePlayerMovement(dir, player, grid);
+            Direction dir = directionTo(dR, dC, player.row);
+            handlePlayerMovement(dir, player, grid, turns);
         } else {
             if (recalculatePathInAutoMovement(grid, player, pathCells, goalRow, goalCol)) {
             } else {
@@ -145,8 +139,8 @@ void updateAutoMovement(
         return;
     }
     
-    Keyboard::Key dir = keyFromDelta(dR, dC, player.row);
-    handlePlayerMovement(dir, player, grid);
+    Direction dir = directionTo(dR, dC, player.row);
+    handlePlayerMovement(dir, player, grid, turns);
 }
 
 }
\ No newline at end of file
@@ -5,6 +5,8 @@
 #include "../model/Player.hpp"
 #include <vector>
 
+class TurnSystem;
+
 namespace core {
 
 /**
@@ -12,6 +14,7 @@ namespace core {
  * 
  * @param grid 
  * @param player 
+ * @param turns 
  * @param pathCells 
  * @param goalRow 
  * @param goalCol 
@@ -19,6 +22,7 @@ namespace core {
 void updateAutoMovement(
     model::HexGrid& grid,
     model::Player& player,
+    TurnSystem& turns,
     std::vector<std::pair<int, int>>& pathCells,
     int goalRow,
     int goalCol
@@ -0,0 +1,77 @@
+#include "BudgetedSolver.hpp"
+
+using namespace model;
+
+namespace core {
+
+BudgetedSolver::BudgetedSolver(std::chrono::microseconds budget)
+    : m_budget(budget)
+{
+}
+
+void BudgetedSolver::request(HexGrid& grid,
+                             int startRow, int startCol,
+                             int goalRow, int goalCol,
+                             int initialEnergy)
+{
+    m_grid = &grid;
+    m_version = grid.version();
+    m_requestRow = startRow;
+    m_requestCol = startCol;
+    m_requestEnergy = initialEnergy;
+    m_partial.clear();
+
+    m_requestKey = PathCache::keyFor(grid, startRow, startCol, goalRow, goalCol, initialEnergy);
+    if (const PathfindingResult* cached = PathCache::local().find(m_requestKey)) {
+        m_cached = *cached;
+        return;
+    }
+    m_cached.reset();
+
+    m_search.begin(grid, startRow, startCol, goalRow, goalCol, initialEnergy);
+}
+
+void BudgetedSolver::cancel()
+{
+    m_grid = nullptr;
+    m_cached.reset();
+    m_partial.clear();
+}
+
+bool BudgetedSolver::isStale(const HexGrid& grid, int row, int col, int energy) const
+{
+    return m_grid != nullptr &&
+        (m_grid != &grid || m_version != grid.version() ||
+         m_requestRow != row || m_requestCol != col || m_requestEnergy != energy);
+}
+
+std::optional<PathfindingResult> BudgetedSolver::poll()
+{
+    if (m_grid == nullptr) {
+        return std::nullopt;
+    }
+
+    if (m_cached) {
+        PathfindingResult result = std::move(*m_cached);
+        m_cached.reset();
+        m_grid = nullptr;
+        return result;
+    }
+
+    if (m_search.runFor(m_budget) == SearchStatus::InProgress) {
+        m_partial.clear();
+        for (const HexCell& cell : m_search.partialResult().path) {
+            m_partial.emplace_back(cell.row, cell.col);
+        }
+        return std::nullopt;
+    }
+
+    m_grid = nullptr;
+    m_partial.clear();
+
+    PathfindingResult result = m_search.result();
+    PathCache::local().store(m_requestKey, result);
+    return result;
+}
+
+}
@@ -0,0 +1,64 @@
+#ifndef BUDGETEDSOLVER_HPP
+#define BUDGETEDSOLVER_HPP
+
+#include "../model/HexGrid.hpp"
+#include "AStarSearch.hpp"
+#include "PathCache.hpp"
+#include "PathFinding.hpp"
+#include <chrono>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace core {
+
+/**
+ * @brief Misma interfaz que AsyncSolver, pero sin hilos: la busqueda avanza
+ * un tramo de tiempo fijo en cada poll() y conserva su estado entre frames.
+ *
+ * Busca sobre el grid vivo, sin copia: si el grid cambia mientras tanto
+ * isStale() lo detecta y hay que volver a pedir la busqueda. Como AsyncSolver,
+ * consulta y alimenta la PathCache del hilo.
+ */
+class BudgetedSolver
+{
+public:
+    static constexpr std::chrono::microseconds DEFAULT_BUDGET{ 4000 };
+
+    explicit BudgetedSolver(std::chrono::microseconds budget = DEFAULT_BUDGET);
+
+    void request(model::HexGrid& grid,
+                 int startRow, int startCol,
+                 int goalRow, int goalCol,
+                 int initialEnergy);
+
+    void cancel();
+
+    bool busy() const { return m_grid != nullptr; }
+
+    bool isStale(const model::HexGrid& grid, int row, int col, int energy) const;
+
+    // Avanza la busqueda como mucho un tramo y devuelve el resultado si termino.
+    std::optional<PathfindingResult> poll();
+
+    // Camino hacia la celda mas cercana a la meta alcanzada hasta ahora (vacio si no hay busqueda).
+    const std::vector<std::pair<int, int>>& partialPath() const { return m_partial; }
+
+private:
+    std::chrono::microseconds m_budget;
+    AStarSearch m_search;
+
+    const model::HexGrid* m_grid = nullptr;
+    unsigned long long m_version = 0;
+    int m_requestRow = -1;
+    int m_requestCol = -1;
+    int m_requestEnergy = -1;
+    PathKey m_requestKey{};
+    std::optional<PathfindingResult> m_cached;
+
+    std::vector<std::pair<int, int>> m_partial;
+};
+
+}
+
+#endif
@@ -0,0 +1,57 @@
+#ifndef DIRECTION_HPP
+#define DIRECTION_HPP
+
+#include <cstdint>
+#include <optional>
+#include <utility>
+
+namespace core {
+
+// Las seis direcciones de movimiento en el layout "odd-r".
+enum class Direction : std::uint8_t
+{
+    UpLeft,
+    UpRight,
+    Left,
+    Right,
+    DownLeft,
+    DownRight,
+};
+
+// Desplazamiento (fila, columna) de una direccion; depende de la paridad de la fila.
+inline std::pair<int, int> directionOffset(Direction direction, int currentRow)
+{
+    bool isOdd = currentRow % 2 != 0;
+
+    switch (direction) {
+        case Direction::UpLeft:
+            return {-1, isOdd ? 0 : -1};
+        case Direction::UpRight:
+            return {-1, isOdd ? 1 : 0};
+        case Direction::Left:
+            return {0, -1};
+        case Direction::Right:
+            return {0, 1};
+        case Direction::DownLeft:
+            return {1, isOdd ? 0 : -1};
+        case Direction::DownRight:
+            return {1, isOdd ? 1 : 0};
+    }
+    return {0, 0};
+}
+
+// Direccion que lleva de una celda a su vecina, si son adyacentes.
+inline std::optional<Direction> directionFromDelta(int dRow, int dCol, int currentRow)
+{
+    for (Direction direction : { Direction::UpLeft, Direction::UpRight, Direction::Left,
+                                 Direction::Right, Direction::DownLeft, Direction::DownRight }) {
+        if (directionOffset(direction, currentRow) == std::make_pair(dRow, dCol)) {
+            return direction;
+        }
+    }
+    return std::nullopt;
+}
+
+}
+
+#endif
@@ -0,0 +1,163 @@
+#include "DistanceField.hpp"
+#include <algorithm>
+#include <tuple>
+
+using namespace model;
+
+namespace core {
+
+namespace {
+
+constexpr int UNKNOWN = -1;
+
+}
+
+void DistanceField::begin(HexGrid& grid, int goalRow, int goalCol)
+{
+    m_grid = &grid;
+    m_version = grid.version();
+    m_rows = grid.rows();
+    m_cols = grid.cols();
+    m_stats = FieldStats{};
+    m_transitions.build(grid, grid.types(), grid.index(goalRow, goalCol));
+
+    const int sink = m_transitions.sink();
+    m_distance.assign(sink + 1, UNKNOWN);
+    m_frontier.clear();
+    m_head = 0;
+
+    m_distance[sink] = 0;
+    m_frontier.push_back(sink);
+}
+
+bool DistanceField::builtFor(const HexGrid& grid, int goalRow, int goalCol) const
+{
+    return m_grid == &grid && m_version == grid.version() &&
+        m_rows == grid.rows() && m_cols == grid.cols() &&
+        m_transitions.goalCell() == grid.index(goalRow, goalCol);
+}
+
+// Estado desde el que se busca: como en AStarSearch, el jugador primero termina de deslizarse.
+int DistanceField::startState(int row, int col, int energy) const
+{
+    int cell = m_grid->index(row, col);
+    int goalCell = m_transitions.goalCell();
+    if (cell == goalCell) {
+        return m_transitions.sink();
+    }
+
+    ConveyorJump jump = m_grid->conveyors().jump(cell);
+    if (jump.target == goalCell) {
+        return m_transitions.sink();
+    }
+    return stateIndex(jump.target, std::min(energy + jump.gain, MAX_ENERGY));
+}
+
+SearchStatus DistanceField::extendTo(int startRow, int startCol, int initialEnergy, std::size_t maxExpansions)
+{
+    int start = startState(startRow, startCol, initialEnergy);
+    if (m_distance[start] != UNKNOWN) {
+        ++m_stats.queries;
+        return SearchStatus::Found;
+    }
+
+    std::size_t expandedNow = 0;
+    while (m_head < m_frontier.size()) {
+        if (expandedNow >= maxExpansions) {
+            return SearchStatus::InProgress;
+        }
+
+        int state = m_frontier[m_head++];
+        int next = m_distance[state] + 1;
+        ++m_stats.expanded;
+        ++expandedNow;
+
+        // Costos unitarios: la primera distancia asignada ya es la definitiva.
+        m_transitions.forEachPredecessor(*m_grid, m_grid->types(), state, [&](int previous) {
+            if (m_distance[previous] == UNKNOWN) {
+                m_distance[previous] = next;
+                m_frontier.push_back(previous);
+            }
+        });
+
+        if (m_distance[start] != UNKNOWN) {
+            return SearchStatus::Found;
+        }
+    }
+
+    m_stats.complete = true;
+    return SearchStatus::Unreachable;
+}
+
+int DistanceField::moves(int row, int col, int energy) const
+{
+    return m_distance[startState(row, col, energy)];
+}
+
+int DistanceField::bestSuccessor(int state, int* entered) const
+{
+    int best = -1;
+    m_transitions.forEachSuccessor(*m_grid, m_grid->types(), state, [&](int next, int neighbor) {
+        if (m_distance[next] != UNKNOWN && (best < 0 || m_distance[next] < m_distance[best])) {
+            best = next;
+            *entered = neighbor;
+        }
+    });
+    return best;
+}
+
+std::optional<std::pair<int, int> > DistanceField::nextStep(int row, int col, int energy) const
+{
+    int start = startState(row, col, energy);
+    if (start == m_transitions.sink() || m_distance[start] == UNKNOWN) {
+        return std::nullopt;
+    }
+
+    int entered = -1;
+    if (bestSuccessor(start, &entered) < 0) {
+        return std::nullopt;
+    }
+    return std::make_pair(entered / m_cols, entered % m_cols);
+}
+
+PathfindingResult DistanceField::path(int startRow, int startCol, int initialEnergy) const
+{
+    int state = startState(startRow, startCol, initialEnergy);
+    if (m_distance[state] == UNKNOWN) {
+        return PathfindingResult{ std::vector<HexCell>(), false };
+    }
+
+    std::vector<std::pair<int, int> > keyPoints;
+    int startCell = m_transitions.cellOf(state);
+    keyPoints.emplace_back(startCell / m_cols, startCell % m_cols);
+
+    // Cada sucesor elegido esta exactamente un movimiento mas cerca de la meta.
+    while (state != m_transitions.sink()) {
+        int entered = -1;
+        state = bestSuccessor(state, &entered);
+        if (state < 0) {
+            return PathfindingResult{ std::vector<HexCell>(), false };
+        }
+        int cell = m_transitions.cellOf(state);
+        keyPoints.emplace_back(cell / m_cols, cell % m_cols);
+    }
+
+    HexGrid& grid = *m_grid;
+    std::vector<std::pair<int, int> > completePath = getStepByStepPath(grid, keyPoints, initialEnergy);
+
+    std::vector<HexCell> path;
+    path.reserve(completePath.size() + 1);
+    for (const auto& point : completePath) {
+        path.push_back(grid.at(point.first, point.second));
+    }
+
+    int goalRow = m_transitions.goalCell() / m_cols;
+    int goalCol = m_transitions.goalCell() % m_cols;
+    if (path.empty() || path.back().row != goalRow || path.back().col != goalCol) {
+        path.push_back(grid.at(goalRow, goalCol));
+    }
+
+    return PathfindingResult{ path, true };
+}
+
+}
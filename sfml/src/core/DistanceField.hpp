@@ -0,0 +1,84 @@
+#ifndef DISTANCEFIELD_HPP
+#define DISTANCEFIELD_HPP
+
+#include "../model/HexGrid.hpp"
+#include "../model/Player.hpp"
+#include "AStarSearch.hpp"
+#include "PathFinding.hpp"
+#include "StateTransitions.hpp"
+#include <cstddef>
+#include <limits>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace core {
+
+struct FieldStats
+{
+    std::size_t expanded = 0;   // estados asentados desde begin()
+    std::size_t queries = 0;    // consultas respondidas sin expandir nada
+    bool complete = false;
+};
+
+/**
+ * @brief Distancias a la meta de todos los estados (celda, energia) de un grid.
+ *
+ * Es una busqueda en anchura hacia atras desde la meta, con las transiciones
+ * de StateTransitions. No se calcula entera de una vez: extendTo() avanza
+ * solo hasta asentar el estado pedido, y las consultas siguientes
+ * desde estados mas cercanos a la meta se responden sin expandir nada. Con
+ * la distancia de cada estado el camino se arma bajando por el sucesor de
+ * distancia minima, en tiempo proporcional a su largo.
+ *
+ * El campo vale para una version del grid: si cambia (pared nueva o rota)
+ * builtFor() devuelve false y hay que llamar de nuevo a begin().
+ */
+class DistanceField
+{
+public:
+    static constexpr int MAX_ENERGY = model::Player::MAX_ENERGY;
+    static constexpr int ENERGY_LEVELS = MAX_ENERGY + 1;
+
+    void begin(model::HexGrid& grid, int goalRow, int goalCol);
+
+    bool builtFor(const model::HexGrid& grid, int goalRow, int goalCol) const;
+
+    // Expande hasta conocer la distancia desde el estado del jugador, agotar
+    // `maxExpansions` (InProgress) o recorrer todo el grid sin llegar a el.
+    SearchStatus extendTo(int startRow, int startCol, int initialEnergy,
+                          std::size_t maxExpansions = std::numeric_limits<std::size_t>::max());
+
+    // Movimientos hasta la meta, o -1 si el estado aun no se alcanzo.
+    int moves(int row, int col, int energy) const;
+
+    // Primera celda a la que moverse desde el estado del jugador.
+    std::optional<std::pair<int, int> > nextStep(int row, int col, int energy) const;
+
+    // Camino completo; requiere que extendTo() haya devuelto Found para ese estado.
+    PathfindingResult path(int startRow, int startCol, int initialEnergy) const;
+
+    const FieldStats& stats() const { return m_stats; }
+
+private:
+    int stateIndex(int cell, int energy) const { return cell * ENERGY_LEVELS + energy; }
+    int startState(int row, int col, int energy) const;
+    int bestSuccessor(int state, int* entered) const;
+
+    model::HexGrid* m_grid = nullptr;
+    unsigned long long m_version = 0;
+    int m_rows = 0;
+    int m_cols = 0;
+
+    std::vector<int> m_distance;
+    std::vector<int> m_frontier;   // cola FIFO; los estados antes de m_head ya se expandieron
+    std::size_t m_head = 0;
+
+    StateTransitions m_transitions;
+
+    FieldStats m_stats;
+};
+
+}
+
+#endif
@@ -0,0 +1,36 @@
+#include "FixedTimestep.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace core {
+
+FixedTimestep::FixedTimestep(double tickRate, int maxTicksPerFrame)
+    : m_tick(1.0 / std::max(1.0, tickRate)),
+      m_maxTicksPerFrame(std::max(1, maxTicksPerFrame))
+{
+}
+
+int FixedTimestep::advance(double frameSeconds)
+{
+    m_accumulator += std::max(0.0, frameSeconds);
+
+    int ticks = static_cast<int>(m_accumulator / m_tick);
+    if (ticks > m_maxTicksPerFrame) {
+        // Se conserva solo la fraccion del tick en curso para que alpha siga siendo valida.
+        double kept = std::fmod(m_accumulator, m_tick);
+        m_dropped += m_accumulator - kept - m_maxTicksPerFrame * m_tick;
+        m_accumulator = kept + m_maxTicksPerFrame * m_tick;
+        ticks = m_maxTicksPerFrame;
+    }
+
+    m_accumulator -= ticks * m_tick;
+    return ticks;
+}
+
+void FixedTimestep::reset()
+{
+    m_accumulator = 0.0;
+    m_dropped = 0.0;
+}
+
+}
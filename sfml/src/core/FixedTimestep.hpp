@@ -0,0 +1,47 @@
+#ifndef FIXEDTIMESTEP_HPP
+#define FIXEDTIMESTEP_HPP
+
+namespace core {
+
+/**
+ * @brief Acumulador de tiempo real para simular a un ritmo fijo de ticks.
+ *
+ * Cada frame se le pasa lo que duro el frame anterior y devuelve cuantos
+ * ticks de simulacion tocan; lo que sobra queda acumulado para el siguiente.
+ * alpha() es la fraccion del proximo tick ya transcurrida, para dibujar
+ * interpolando entre el estado del tick anterior y el actual.
+ *
+ * Si un frame tarda demasiado se simulan como mucho maxTicksPerFrame ticks
+ * y el resto se descarta: la partida se frena un momento en vez de quedar
+ * atrapada intentando alcanzar al reloj.
+ */
+class FixedTimestep
+{
+public:
+    static constexpr double DEFAULT_TICK_RATE = 60.0;
+    static constexpr int DEFAULT_MAX_TICKS_PER_FRAME = 5;
+
+    explicit FixedTimestep(double tickRate = DEFAULT_TICK_RATE,
+                           int maxTicksPerFrame = DEFAULT_MAX_TICKS_PER_FRAME);
+
+    int advance(double frameSeconds);
+    void reset();
+
+    double tickRate() const { return 1.0 / m_tick; }
+    double tickSeconds() const { return m_tick; }
+    float alpha() const { return static_cast<float>(m_accumulator / m_tick); }
+
+    // Segundos de tiempo real que no se simularon por frames demasiado lentos,
+    // desde la creacion o el ultimo reset().
+    double droppedSeconds() const { return m_dropped; }
+
+private:
+    double m_tick;
+    int m_maxTicksPerFrame;
+    double m_accumulator = 0.0;
+    double m_dropped = 0.0;
+};
+
+}
+
+#endif
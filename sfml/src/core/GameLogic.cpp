@@ -1,113 +1,73 @@
 #include "GameLogic.hpp"
 #include "TurnSystem.hpp"
 #include "../model/HexCell.hpp"
-#include "../utils/Utils.hpp"
 #include "../model/Player.hpp"
-#include <SFML/System.hpp>
+#include <algorithm>
+#include <atomic>
 #include <iostream>
 
 using namespace model;
-using namespace sf;
 
-HexCell* findStartCell(HexGrid& grid) {
-    for (int y = 0; y < grid.rows(); ++y) {
-        for (int x = 0; x < grid.cols(); ++x) {
-            if (grid.at(y, x).type == CellType::START)
-                return &grid.at(y, x);
-        }
-    }
-    std::cerr << "No se encontro celda de inicio (START)\n";
-    return nullptr;
+namespace {
+
+std::atomic<bool> g_logEnabled{ true };
+
+bool logEnabled() {
+    return g_logEnabled.load(std::memory_order_relaxed);
 }
 
-HexCell* findGoalCell(HexGrid& grid) {
-    for (int y = 0; y < grid.rows(); ++y) {
-        for (int x = 0; x < grid.cols(); ++x) {
-            if (grid.at(y, x).type == CellType::GOAL)
-                return &grid.at(y, x);
-        }
-    }
-    std::cerr << "No se encontro celda de meta (GOAL)\n";
-    return nullptr;
 }
 
-void handlePlayerMovement(Keyboard::Key key, Player& player, HexGrid& grid) {
+void setGameLogEnabled(bool enabled) {
+    g_logEnabled.store(enabled, std::memory_order_relaxed);
+}
+
+static std::optional<HexCell> findFirstCell(const HexGrid& grid, CellType type) {
+    const std::vector<CellType>& types = grid.types();
+    auto it = std::find(types.begin(), types.end(), type);
+    if (it == types.end())
+        return std::nullopt;
+
+    int index = static_cast<int>(it - types.begin());
+    return grid.at(grid.rowOf(index), grid.colOf(index));
+}
+
+std::optional<HexCell> findStartCell(const HexGrid& grid) {
+    std::optional<HexCell> start = findFirstCell(grid, CellType::START);
+    if (!start && logEnabled())
+        std::cerr << "No se encontro celda de inicio (START)\n";
+    return start;
+}
+
+std::optional<HexCell> findGoalCell(const HexGrid& grid) {
+    std::optional<HexCell> goal = findFirstCell(grid, CellType::GOAL);
+    if (!goal && logEnabled())
+        std::cerr << "No se encontro celda de meta (GOAL)\n";
+    return goal;
+}
+
+void handlePlayerMovement(core::Direction direction, Player& player, HexGrid& grid, TurnSystem& turns) {
     if (player.isMoving)
         return;
 
     if (player.isSelectingWall) {
-        if (isValidWallBreakDirection(key)) {
-            handleWallBreak(key, player, grid);
-            return;
-        }
-        else if (key == Keyboard::Escape || key == Keyboard::Space) {
-            player.isSelectingWall = false;
-            std::cout << "Seleccion de pared cancelada." << std::endl;
-            return;
-        }
-    }
-
-    if (key == Keyboard::Space) {
-        if (player.canUseWallBreak()) {
-            player.isSelectingWall = true;
-            std::cout << "Modo seleccion de pared activado!" << std::endl;
-            std::cout << "Usa W/E (arriba), A/D (lados), Z/X (abajo) para elegir que pared romper." << std::endl;
-            std::cout << "Presiona ESC para cancelar." << std::endl;
-            return;
-        } else {
-            if (!player.isEnergyFull()) {
-                std::cout << "Energia insuficiente. Necesitas " << Player::MAX_ENERGY
-                    << " puntos de energia. Actual: " << player.energy << std::endl;
-            }
-            return;
-        }
+        handleWallBreak(direction, player, grid, turns);
+        return;
     }
 
-    int row = player.row, col = player.col;
-    int newRow = row, newCol = col;
-    bool isOdd = row % 2 != 0;
-    bool moved = false;
+    auto [dRow, dCol] = core::directionOffset(direction, player.row);
+    int newRow = player.row + dRow;
+    int newCol = player.col + dCol;
 
-    if (key == Keyboard::W) {
-        newRow = row - 1;
-        newCol = isOdd ? col : col - 1;
-        moved = true;
-    }
-    else if (key == Keyboard::E) {
-        newRow = row - 1;
-        newCol = isOdd ? col + 1 : col;
-        moved = true;
-    }
-    else if (key == Keyboard::A) {
-        newRow = row;
-        newCol = col - 1;
-        moved = true;
-    }
-    else if (key == Keyboard::D) {
-        newRow = row;
-        newCol = col + 1;
-        moved = true;
-    }
-    else if (key == Keyboard::Z) {
-        newRow = row + 1;
-        newCol = isOdd ? col : col - 1;
-        moved = true;
-    }
-    else if (key == Keyboard::X) {
-        newRow = row + 1;
-        newCol = isOdd ? col + 1 : col;
-        moved = true;
-    }
-
-    if (moved && newRow >= 0 && newRow < grid.rows() && newCol >= 0 && newCol < grid.cols()) {
-        const auto& target = grid.at(newRow, newCol);
+    if (grid.inBounds(newRow, newCol)) {
+        HexCell target = grid.at(newRow, newCol);
 
         if (target.type != CellType::WALL) {
             int oldRow = player.row;
             int oldCol = player.col;
             
-            Vector2f startPos = grid.toPixel(player.row, player.col);
-            Vector2f targetPos = grid.toPixel(newRow, newCol);
+            Vec2f startPos = grid.toPixel(player.row, player.col);
+            Vec2f targetPos = grid.toPixel(newRow, newCol);
             player.startMovement(startPos, targetPos);
 
             player.lastCellType = grid.at(player.row, player.col).type;
@@ -115,95 +75,110 @@ void handlePlayerMovement(Keyboard::Key key, Player& player, HexGrid& grid) {
             player.row = newRow;
             player.col = newCol;
 
-            std::cout << "Jugador movido de (" << oldRow << ", " << oldCol << ") a (" << player.row << ", " << player.col << ")" << std::endl;
+            if (logEnabled())
+                std::cout << "Jugador movido de (" << oldRow << ", " << oldCol << ") a (" << player.row << ", " << player.col << ")" << std::endl;
 
             if (target.type == CellType::GOAL) {
-                if (player.row == newRow && player.col == newCol) {
-                    player.hasWon = true;
-                    player.winTime = player.winClock.getElapsedTime().asSeconds();
+                player.win();
+                if (logEnabled())
                     std::cout << "VICTORIA CONFIRMADA! Jugador en META (" << player.row << ", " << player.col << ") en " << player.winTime << " segundos!" << std::endl;
-                    return;
-                } else {
-                    std::cout << "ERROR: target es GOAL pero jugador no esta en la posicion correcta!" << std::endl;
-                }
+                return;
             }
 
             if (!player.hasWon) {
                 player.gainEnergy();
-                TurnSystem::handleTurn(grid, player);
-                std::cout << "Movimiento completado. Energia: " << player.energy << ", Celda: " << static_cast<int>(target.type) << std::endl;
+                turns.handleTurn(grid, player);
+                if (logEnabled())
+                    std::cout << "Movimiento completado. Energia: " << player.energy << ", Celda: " << static_cast<int>(target.type) << std::endl;
             }
-        } else {
+        } else if (logEnabled()) {
             std::cout << "Movimiento bloqueado por pared en (" << newRow << ", " << newCol << ")" << std::endl;
         }
-    } else {
+    } else if (logEnabled()) {
         std::cout << "Movimiento fuera de limites o invalido" << std::endl;
     }
 }
 
-void handleWallBreak(Keyboard::Key key, Player& player, HexGrid& grid) {
-    if (!player.canUseWallBreak() || !player.isSelectingWall) {
+void toggleWallSelection(Player& player) {
+    if (player.isMoving)
+        return;
+
+    if (player.isSelectingWall) {
+        cancelWallSelection(player);
         return;
     }
 
-    auto [wallRow, wallCol] = getWallPositionInDirection(player, key, grid);
+    if (player.canUseWallBreak()) {
+        player.isSelectingWall = true;
+        if (logEnabled()) {
+            std::cout << "Modo seleccion de pared activado!" << std::endl;
+            std::cout << "Usa W/E (arriba), A/D (lados), Z/X (abajo) para elegir que pared romper." << std::endl;
+            std::cout << "Presiona ESC para cancelar." << std::endl;
+        }
+    } else if (!player.isEnergyFull() && logEnabled()) {
+        std::cout << "Energia insuficiente. Necesitas " << Player::MAX_ENERGY
+            << " puntos de energia. Actual: " << player.energy << std::endl;
+    }
+}
 
-    if (wallRow == -1 || wallCol == -1) {
-        std::cout << "No hay pared en esa direccion." << std::endl;
+void cancelWallSelection(Player& player) {
+    if (!player.isSelectingWall)
         return;
+
+    player.isSelectingWall = false;
+    if (logEnabled())
+        std::cout << "Seleccion de pared cancelada." << std::endl;
+}
+
+void applyAction(const core::Action& action, Player& player, HexGrid& grid, TurnSystem& turns) {
+    switch (action.type) {
+        case core::Action::Type::Move:
+            handlePlayerMovement(action.direction, player, grid, turns);
+            break;
+        case core::Action::Type::ToggleWallSelect:
+            toggleWallSelection(player);
+            break;
+        case core::Action::Type::Cancel:
+            cancelWallSelection(player);
+            break;
     }
+}
 
-    if (wallRow < 0 || wallRow >= grid.rows() || wallCol < 0 || wallCol >= grid.cols()) {
-        std::cout << "Posicion fuera de los limites del grid." << std::endl;
+void handleWallBreak(core::Direction direction, Player& player, HexGrid& grid, TurnSystem& turns) {
+    if (!player.canUseWallBreak() || !player.isSelectingWall) {
+        return;
+    }
+
+    auto [wallRow, wallCol] = getWallPositionInDirection(player, direction, grid);
+
+    if (wallRow == -1 || wallCol == -1) {
+        if (logEnabled())
+            std::cout << "No hay pared en esa direccion." << std::endl;
         return;
     }
 
     if (grid.at(wallRow, wallCol).type != CellType::WALL) {
-        std::cout << "No hay una pared en esa posicion." << std::endl;
+        if (logEnabled())
+            std::cout << "No hay una pared en esa posicion." << std::endl;
         return;
     }
 
-    grid.at(wallRow, wallCol).type = CellType::EMPTY;
+    grid.setType(wallRow, wallCol, CellType::EMPTY);
+    turns.onCellChanged(grid, wallRow, wallCol);
     player.useWallBreak();
     player.isSelectingWall = false;
 
-    std::cout << "Pared rota en posicion (" << wallRow << ", " << wallCol << ")!" << std::endl;
+    if (logEnabled())
+        std::cout << "Pared rota en posicion (" << wallRow << ", " << wallCol << ")!" << std::endl;
 }
 
-std::pair<int, int> getDirectionalOffset(sf::Keyboard::Key key, int currentRow) {
-    bool isOdd = currentRow % 2 != 0;
-   
-    switch (key) {
-        case Keyboard::W:
-            return {-1, isOdd ? 0 : -1};
-        case Keyboard::E:
-            return {-1, isOdd ? 1 : 0};
-        case Keyboard::A:
-            return {0, -1};
-        case Keyboard::D:
-            return {0, 1};
-        case Keyboard::Z:
-            return {1, isOdd ? 0 : -1};
-        case Keyboard::X:
-            return {1, isOdd ? 1 : 0};
-        default:
-            return {0, 0};
-    }
-}
-
-bool isValidWallBreakDirection(sf::Keyboard::Key key) {
-    return (key == Keyboard::W || key == Keyboard::E ||
-            key == Keyboard::A || key == Keyboard::D ||
-            key == Keyboard::Z || key == Keyboard::X);
-}
-
-std::pair<int, int> getWallPositionInDirection(const Player& player, sf::Keyboard::Key direction, const HexGrid& grid) {
-    auto [deltaRow, deltaCol] = getDirectionalOffset(direction, player.row);
+std::pair<int, int> getWallPositionInDirection(const Player& player, core::Direction direction, const HexGrid& grid) {
+    auto [deltaRow, deltaCol] = core::directionOffset(direction, player.row);
    
     int wallRow = player.row + deltaRow;
     int wallCol = player.col + deltaCol;
    
-    if (wallRow < 0 || wallRow >= grid.rows() || wallCol < 0 || wallCol >= grid.cols()) {
+    if (!grid.inBounds(wallRow, wallCol)) {
         return {-1, -1};
     }
    
@@ -214,60 +189,57 @@ std::vector<std::pair<int, int>> findAdjacentWalls(const Player& player, const H
     std::vector<std::pair<int, int>> walls;
 
     HexCell currentCell(player.row, player.col, CellType::EMPTY);
-    auto neighbors = const_cast<HexGrid&>(grid).neighbors(currentCell);
+    auto neighbors = grid.neighbors(currentCell);
 
-    for (const auto* neighbor : neighbors) {
-        if (neighbor && neighbor->type == CellType::WALL) {
-            walls.push_back({ neighbor->row, neighbor->col });
+    for (const auto& neighbor : neighbors) {
+        if (neighbor.type == CellType::WALL) {
+            walls.push_back({ neighbor.row, neighbor.col });
         }
     }
 
     return walls;
 }
 
-void handleConveyorMovement(Player& player, const HexGrid& grid) {
+bool handleConveyorMovement(Player& player, const HexGrid& grid) {
     if (player.isMoving || player.hasWon)
-        return;
-
-    const HexCell& current = grid.at(player.row, player.col);
-
-    if (!(current.type >= CellType::UP_RIGHT && current.type <= CellType::DOWN_LEFT))
-        return;
-
-    bool isOdd = player.row % 2 != 0;
-    std::pair<int, int> offset = getConveyorOffset(current.type, isOdd);
-    int newRow = player.row + offset.first;
-    int newCol = player.col + offset.second;
-
-    if (newRow >= 0 && newRow < grid.rows() && newCol >= 0 && newCol < grid.cols()) {
-        const auto& target = grid.at(newRow, newCol);
-        if (target.type != CellType::WALL) {
-            int oldRow = player.row;
-            int oldCol = player.col;
-            
-            Vector2f startPos = grid.toPixel(player.row, player.col);
-            Vector2f targetPos = grid.toPixel(newRow, newCol);
-            player.startMovement(startPos, targetPos);
-
-            player.lastCellType = current.type;
-            
-            player.row = newRow;
-            player.col = newCol;
-            
-            std::cout << "Banda transportadora: (" << oldRow << ", " << oldCol << ") -> (" << player.row << ", " << player.col << ")" << std::endl;
-
-            if (target.type == CellType::GOAL) {
-                if (player.row == newRow && player.col == newCol) {
-                    player.hasWon = true;
-                    player.winTime = player.winClock.getElapsedTime().asSeconds();
-                    std::cout << "VICTORIA POR BANDA TRANSPORTADORA! Jugador en META (" << player.row << ", " << player.col << ")!" << std::endl;
-                    return;
-                }
-            }
-
-            if (!player.hasWon) {
-                player.gainEnergy();
-            }
-        }
-    }
-}
\ No newline at end of file
+        return false;
+
+    HexCell current = grid.at(player.row, player.col);
+
+    if (!isConveyor(current.type))
+        return false;
+
+    // La tabla ya descarta bandas bloqueadas y ciclos: una banda ciclica no mueve al jugador.
+    int next = grid.conveyors().next(grid, grid.index(player.row, player.col));
+    if (next < 0)
+        return false;
+
+    int newRow = next / grid.cols();
+    int newCol = next % grid.cols();
+    HexCell target = grid.at(newRow, newCol);
+
+    int oldRow = player.row;
+    int oldCol = player.col;
+    
+    Vec2f startPos = grid.toPixel(player.row, player.col);
+    Vec2f targetPos = grid.toPixel(newRow, newCol);
+    player.startMovement(startPos, targetPos);
+
+    player.lastCellType = current.type;
+    
+    player.row = newRow;
+    player.col = newCol;
+    
+    if (logEnabled())
+        std::cout << "Banda transportadora: (" << oldRow << ", " << oldCol << ") -> (" << player.row << ", " << player.col << ")" << std::endl;
+
+    if (target.type == CellType::GOAL) {
+        player.win();
+        if (logEnabled())
+            std::cout << "VICTORIA POR BANDA TRANSPORTADORA! Jugador en META (" << player.row << ", " << player.col << ")!" << std::endl;
+        return true;
+    }
+
+    player.gainEnergy();
+    return true;
+}
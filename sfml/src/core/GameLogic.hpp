@@ -4,26 +4,37 @@
 
 #include "../model/HexGrid.hpp"
 #include "../model/Player.hpp"
-#include <SFML/Window.hpp>
+#include "Action.hpp"
+#include "Direction.hpp"
+#include <optional>
 #include <vector>
 #include <utility>
 
 
 using namespace model;
 
-HexCell* findStartCell(HexGrid& grid);
+std::optional<HexCell> findStartCell(const HexGrid& grid);
 
-HexCell* findGoalCell(HexGrid& grid);
+std::optional<HexCell> findGoalCell(const HexGrid& grid);
 
-void handlePlayerMovement(sf::Keyboard::Key key, Player& player, HexGrid& grid);
-void handleConveyorMovement(Player& player, const HexGrid& grid);
+class TurnSystem;
 
-void handleWallBreak(sf::Keyboard::Key key, Player& player, HexGrid& grid);
+// Los mensajes de las reglas van a la consola; una simulacion masiva los apaga.
+void setGameLogEnabled(bool enabled);
+
+void applyAction(const core::Action& action, Player& player, HexGrid& grid, TurnSystem& turns);
+
+void handlePlayerMovement(core::Direction direction, Player& player, HexGrid& grid, TurnSystem& turns);
+void toggleWallSelection(Player& player);
+void cancelWallSelection(Player& player);
+
+// Avanza una celda por la banda en la que esta el jugador; devuelve si se movio.
+bool handleConveyorMovement(Player& player, const HexGrid& grid);
+
+void handleWallBreak(core::Direction direction, Player& player, HexGrid& grid, TurnSystem& turns);
 std::vector<std::pair<int, int>> findAdjacentWalls(const Player& player, const HexGrid& grid);
 
-std::pair<int, int> getDirectionalOffset(sf::Keyboard::Key key, int currentRow);
-bool isValidWallBreakDirection(sf::Keyboard::Key key);
-std::pair<int, int> getWallPositionInDirection(const Player& player, sf::Keyboard::Key direction, const HexGrid& grid);
+std::pair<int, int> getWallPositionInDirection(const Player& player, core::Direction direction, const HexGrid& grid);
 
 
 #endif
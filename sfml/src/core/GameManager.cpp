@@ -1,12 +1,10 @@
 #include "GameManager.hpp"
 #include "../utils/MapLoader.hpp"
-#include "../utils/Utils.hpp"
 #include "PathFinding.hpp"
 #include "TurnSystem.hpp"
 #include <iostream>
 
-HexCell* findStartCell(HexGrid& grid);
-HexCell* findGoalCell(HexGrid& grid);
+#include "GameLogic.hpp"
 
 
 bool isPathStillValid(const HexGrid& grid, const std::vector<std::pair<int, int>>& pathCells,
@@ -30,7 +28,7 @@ bool isPathStillValid(const HexGrid& grid, const std::vector<std::pair<int, int>
     }
    
     for (const auto& cell : pathCells) {
-        CellType cellType = grid.at(cell.first, cell.second).type;
+        CellType cellType = grid.type(cell.first, cell.second);
         if (cellType == CellType::WALL) {
             return false;
         }
@@ -39,17 +37,34 @@ bool isPathStillValid(const HexGrid& grid, const std::vector<std::pair<int, int>
     return true;
 }
 
-bool recalculatePath(HexGrid& grid, Player& player, HexCell* goal,
-                    std::vector<std::pair<int, int>>& pathCells,
-                    bool& showPathVisualization, bool& autoSolveMode) {
-   
-    std::cout << "Recalculando camino desde main..." << std::endl;
-    PathfindingResult newPath = findPath(grid, player.row, player.col, goal->row, goal->col, player.energy);
-   
+bool isPathBlockedSince(const HexGrid& grid, const std::vector<std::pair<int, int>>& pathCells,
+                        unsigned long long since, int playerRow, int playerCol) {
+    bool blocked = false;
+    bool journaled = grid.forEachChangeSince(since, [&](const CellChange& change) {
+        if (blocked || grid.types()[change.cell] != CellType::WALL) {
+            return;
+        }
+        for (const auto& cell : pathCells) {
+            if (grid.index(cell.first, cell.second) == change.cell) {
+                blocked = true;
+                return;
+            }
+        }
+    });
+
+    if (!journaled) {
+        return !isPathStillValid(grid, pathCells, playerRow, playerCol);
+    }
+    return blocked;
+}
+
+bool applyRecalculatedPath(const PathfindingResult& newPath, Player& player,
+                           std::vector<std::pair<int, int>>& pathCells,
+                           bool& showPathVisualization, bool& autoSolveMode) {
     if (newPath.success && !newPath.path.empty()) {
         pathCells.clear();
-        for (auto *cell : newPath.path) {
-            pathCells.emplace_back(cell->row, cell->col);
+        for (const auto& cell : newPath.path) {
+            pathCells.emplace_back(cell.row, cell.col);
         }
        
         std::cout << "Camino recalculado exitosamente con " << pathCells.size() << " pasos." << std::endl;
@@ -65,7 +80,8 @@ bool recalculatePath(HexGrid& grid, Player& player, HexCell* goal,
     }
 }
 
-bool loadSelectedMap(const std::string& mapPath, HexGrid*& grid, HexCell*& start, HexCell*& goal, Player*& player) {
+bool loadSelectedMap(const std::string& mapPath, HexGrid*& grid, std::optional<HexCell>& start, std::optional<HexCell>& goal, Player*& player, TurnSystem& turns,
+                     const GameClock& clock) {
     try {
         std::cout << "Intentando cargar mapa: " << mapPath << std::endl;
         
@@ -79,19 +95,21 @@ bool loadSelectedMap(const std::string& mapPath, HexGrid*& grid, HexCell*& start
         }
         
         HexGrid tempGrid = loadHexGridFromFile(mapPath);
-        HexCell* tempStart = findStartCell(tempGrid);
-        HexCell* tempGoal = findGoalCell(tempGrid);
+        std::optional<HexCell> tempStart = findStartCell(tempGrid);
+        std::optional<HexCell> tempGoal = findGoalCell(tempGrid);
         
         if (tempStart && tempGoal) {
-            grid = new HexGrid(tempGrid);
-            start = findStartCell(*grid);
-            goal = findGoalCell(*grid);
-            player = new Player(start->row, start->col);
-            TurnSystem::resetTurnCounter();
+            grid = new HexGrid(std::move(tempGrid));
+            start = tempStart;
+            goal = tempGoal;
+            player = new Player(start->row, start->col, clock);
+            turns.resetTurnCounter();
+            turns.rebuildFreeCells(*grid);
             
             std::cout << "Mapa cargado exitosamente: " << mapPath << std::endl;
             std::cout << "Start: (" << start->row << ", " << start->col << ")" << std::endl;
             std::cout << "Goal: (" << goal->row << ", " << goal->col << ")" << std::endl;
+            std::cout << "Semilla de paredes: " << turns.getSeed() << std::endl;
             return true;
         } else {
             std::cout << "Error: Mapa no tiene start y/o goal válidos" << std::endl;
@@ -1,23 +1,34 @@
 #ifndef GAMEMANAGER_HPP
 #define GAMEMANAGER_HPP
 
-#include <SFML/Graphics.hpp>
+#include <optional>
 #include <vector>
 #include <string>
 #include "../model/HexGrid.hpp"
 #include "../model/HexCell.hpp"
 #include "../model/Player.hpp"
+#include "PathFinding.hpp"
 
 using namespace model;
 
+class TurnSystem;
+
 
 bool isPathStillValid(const HexGrid& grid, const std::vector<std::pair<int, int>>& pathCells,
                      int playerRow, int playerCol);
 
-bool recalculatePath(HexGrid& grid, Player& player, HexCell* goal,
-                    std::vector<std::pair<int, int>>& pathCells,
-                    bool& showPathVisualization, bool& autoSolveMode);
+// Alguna celda que cambio desde la version `since` es ahora una pared del camino.
+// Si el diario del grid ya no llega a `since` se revisa el camino entero.
+bool isPathBlockedSince(const HexGrid& grid, const std::vector<std::pair<int, int>>& pathCells,
+                        unsigned long long since, int playerRow, int playerCol);
+
+// Adopta el camino recalculado por el solver del juego, o limpia el estado si no hay camino.
+bool applyRecalculatedPath(const PathfindingResult& newPath, Player& player,
+                           std::vector<std::pair<int, int>>& pathCells,
+                           bool& showPathVisualization, bool& autoSolveMode);
 
-bool loadSelectedMap(const std::string& mapPath, HexGrid*& grid, HexCell*& start, HexCell*& goal, Player*& player);
+// El jugador creado mide su animacion y su tiempo de victoria con `clock`.
+bool loadSelectedMap(const std::string& mapPath, HexGrid*& grid, std::optional<HexCell>& start, std::optional<HexCell>& goal, Player*& player, TurnSystem& turns,
+                     const GameClock& clock = systemClock());
 
 #endif 
\ No newline at end of file
@@ -0,0 +1,274 @@
+#include "IncrementalPlanner.hpp"
+#include <algorithm>
+#include <cstdlib>
+#include <tuple>
+
+using namespace model;
+
+namespace core {
+
+namespace {
+
+constexpr int INF = 1 << 29;
+
+int hexDistance(int rowA, int colA, int rowB, int colB)
+{
+    // Layout "odd-r": se pasa a coordenadas cubicas y se toma la mayor diferencia.
+    int xA = colA - (rowA - (rowA & 1)) / 2;
+    int xB = colB - (rowB - (rowB & 1)) / 2;
+    int dx = xA - xB;
+    int dz = rowA - rowB;
+    return std::max({ std::abs(dx), std::abs(dz), std::abs(dx + dz) });
+}
+
+}
+
+template <typename Visitor>
+void IncrementalPlanner::forEachSuccessor(int state, Visitor&& visit) const
+{
+    m_transitions.forEachSuccessor(*m_grid, m_types, state, [&](int next, int) { visit(next); });
+}
+
+template <typename Visitor>
+void IncrementalPlanner::forEachPredecessor(int state, Visitor&& visit) const
+{
+    m_transitions.forEachPredecessor(*m_grid, m_types, state, visit);
+}
+
+int IncrementalPlanner::heuristic(int fromCell, int toCell) const
+{
+    int distance = hexDistance(fromCell / m_cols, fromCell % m_cols, toCell / m_cols, toCell % m_cols);
+    return (distance + m_slideReach - 1) / m_slideReach;
+}
+
+IncrementalPlanner::Key IncrementalPlanner::calculateKey(int state) const
+{
+    int best = std::min(m_g[state], m_rhs[state]);
+    return Key{ best + heuristic(m_lastStartCell, cellOf(state)) + m_km, best };
+}
+
+int IncrementalPlanner::bestSuccessorCost(int state, int* bestState) const
+{
+    int best = INF;
+    forEachSuccessor(state, [&](int next) {
+        if (m_g[next] < INF && m_g[next] + 1 < best) {
+            best = m_g[next] + 1;
+            if (bestState) {
+                *bestState = next;
+            }
+        }
+    });
+    return best;
+}
+
+void IncrementalPlanner::updateVertex(int state)
+{
+    if (state != m_transitions.sink()) {
+        m_rhs[state] = bestSuccessorCost(state, nullptr);
+    }
+
+    // Cola perezosa: las entradas viejas se descartan al salir.
+    if (m_g[state] != m_rhs[state]) {
+        m_queue.push_back(QueueEntry{ calculateKey(state), state });
+        std::push_heap(m_queue.begin(), m_queue.end(), queueAfter);
+    }
+}
+
+bool IncrementalPlanner::topIsBefore(const Key& key)
+{
+    while (!m_queue.empty() && m_g[m_queue.front().state] == m_rhs[m_queue.front().state]) {
+        std::pop_heap(m_queue.begin(), m_queue.end(), queueAfter);
+        m_queue.pop_back();
+    }
+    return !m_queue.empty() && m_queue.front().key < key;
+}
+
+void IncrementalPlanner::computeShortestPath()
+{
+    while (topIsBefore(calculateKey(m_startState)) || m_rhs[m_startState] != m_g[m_startState]) {
+        if (m_queue.empty()) {
+            break;
+        }
+
+        std::pop_heap(m_queue.begin(), m_queue.end(), queueAfter);
+        QueueEntry top = m_queue.back();
+        m_queue.pop_back();
+
+        int state = top.state;
+        Key current = calculateKey(state);
+
+        if (top.key < current) {
+            m_queue.push_back(QueueEntry{ current, state });
+            std::push_heap(m_queue.begin(), m_queue.end(), queueAfter);
+            continue;
+        }
+        if (current < top.key) {
+            continue;
+        }
+
+        ++m_stats.expanded;
+        if (m_g[state] > m_rhs[state]) {
+            m_g[state] = m_rhs[state];
+            forEachPredecessor(state, [this](int previous) { updateVertex(previous); });
+        }
+        else {
+            m_g[state] = INF;
+            updateVertex(state);
+            forEachPredecessor(state, [this](int previous) { updateVertex(previous); });
+        }
+    }
+}
+
+void IncrementalPlanner::initialize(HexGrid& grid, int goalRow, int goalCol)
+{
+    m_rows = grid.rows();
+    m_cols = grid.cols();
+    m_version = grid.version();
+    m_slideReach = 1 + grid.conveyors().maxSlide();
+
+    m_types = grid.types();
+    m_transitions.build(grid, m_types, goalRow * m_cols + goalCol);
+
+    const int sink = m_transitions.sink();
+    m_g.assign(sink + 1, INF);
+    m_rhs.assign(sink + 1, INF);
+    m_queue.clear();
+    m_km = 0;
+
+    m_rhs[sink] = 0;
+    m_queue.push_back(QueueEntry{ calculateKey(sink), sink });
+
+    m_stats.fullRebuild = true;
+}
+
+void IncrementalPlanner::applyChanges(HexGrid& grid)
+{
+    // Ningun otro grid ni copia reusa una version: misma version, mismo contenido.
+    if (grid.version() == m_version) {
+        return;
+    }
+    m_version = grid.version();
+
+    const int cellCount = m_rows * m_cols;
+    const ConveyorTable& conveyors = grid.conveyors();
+    std::vector<int> changed;
+
+    for (int cell = 0; cell < cellCount; ++cell) {
+        CellType type = grid.types()[cell];
+        bool slideChanged = m_transitions.updateSlide(cell, conveyors.jump(cell));
+
+        if (type != m_types[cell] || slideChanged) {
+            m_types[cell] = type;
+            changed.push_back(cell);
+        }
+    }
+
+    m_stats.changedCells = changed.size();
+    if (changed.empty()) {
+        return;
+    }
+    m_transitions.buildReverseSlides(m_types);
+
+    // Solo cambian las transiciones de los estados que entran a una celda modificada.
+    for (int cell : changed) {
+        m_grid->forEachNeighbor(cell, [this](int from) {
+            for (int e = 0; e <= MAX_ENERGY; ++e) {
+                updateVertex(stateIndex(from, e));
+            }
+        });
+    }
+}
+
+void IncrementalPlanner::reset()
+{
+    m_grid = nullptr;
+    m_transitions = StateTransitions{};
+    m_g.clear();
+    m_rhs.clear();
+    m_queue.clear();
+}
+
+PathfindingResult IncrementalPlanner::plan(HexGrid& grid,
+                                           int startRow, int startCol,
+                                           int goalRow, int goalCol,
+                                           int initialEnergy)
+{
+    m_stats = PlannerStats{};
+
+    int startCell = grid.index(startRow, startCol);
+    int startEnergy = std::min(initialEnergy, MAX_ENERGY);
+    if (grid.at(startRow, startCol).type != CellType::GOAL) {
+        int row, col;
+        std::tie(row, col, startEnergy) = slideThroughBands(grid, startRow, startCol, initialEnergy);
+        startCell = grid.index(row, col);
+    }
+
+    int goalCell = grid.index(goalRow, goalCol);
+    if (startCell == goalCell) {
+        return findPath(grid, startRow, startCol, goalRow, goalCol, initialEnergy);
+    }
+
+    bool rebuild = m_g.empty()
+        || grid.rows() != m_rows || grid.cols() != m_cols
+        || goalCell != m_transitions.goalCell()
+        // Si una banda se alarga la heuristica dejaria de ser admisible.
+        || 1 + grid.conveyors().maxSlide() > m_slideReach;
+
+    m_grid = &grid;
+
+    if (!rebuild) {
+        // km debe avanzar antes de reparar, para que las claves nuevas usen el inicio actual.
+        m_km += heuristic(m_lastStartCell, startCell);
+        m_lastStartCell = startCell;
+
+        applyChanges(grid);
+        if (m_stats.changedCells > static_cast<std::size_t>(m_rows * m_cols) / 4) {
+            rebuild = true;
+        }
+    }
+
+    if (rebuild) {
+        m_lastStartCell = startCell;
+        initialize(grid, goalRow, goalCol);
+    }
+
+    m_startState = stateIndex(startCell, startEnergy);
+    computeShortestPath();
+
+    m_stats.moves = m_g[m_startState] < INF ? m_g[m_startState] : -1;
+    if (m_g[m_startState] >= INF) {
+        return PathfindingResult{ std::vector<HexCell>(), false };
+    }
+
+    // Se recorre siempre el sucesor de menor g hasta llegar a la meta.
+    std::vector<std::pair<int, int> > keyPoints;
+    keyPoints.emplace_back(startCell / m_cols, startCell % m_cols);
+
+    int state = m_startState;
+    for (int steps = m_g[m_startState]; state != m_transitions.sink() && steps > 0; --steps) {
+        int next = -1;
+        bestSuccessorCost(state, &next);
+        if (next < 0) {
+            return PathfindingResult{ std::vector<HexCell>(), false };
+        }
+        state = next;
+        int cell = cellOf(state);
+        keyPoints.emplace_back(cell / m_cols, cell % m_cols);
+    }
+
+    std::vector<std::pair<int, int> > completePath = getStepByStepPath(grid, keyPoints, initialEnergy);
+
+    std::vector<HexCell> path;
+    path.reserve(completePath.size() + 1);
+    for (const auto& point : completePath) {
+        path.push_back(grid.at(point.first, point.second));
+    }
+
+    if (path.empty() || path.back().row != goalRow || path.back().col != goalCol) {
+        path.push_back(grid.at(goalRow, goalCol));
+    }
+
+    return PathfindingResult{ path, true };
+}
+
+}
@@ -0,0 +1,102 @@
+#ifndef INCREMENTALPLANNER_HPP
+#define INCREMENTALPLANNER_HPP
+
+#include "../model/HexGrid.hpp"
+#include "../model/Player.hpp"
+#include "PathFinding.hpp"
+#include "StateTransitions.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace core {
+
+struct PlannerStats
+{
+    std::size_t expanded = 0;
+    std::size_t changedCells = 0;
+    int moves = -1;
+    bool fullRebuild = false;
+};
+
+/**
+ * @brief Planificador incremental D* Lite sobre estados (celda, energia).
+ *
+ * Busca hacia atras desde la meta y conserva g/rhs entre llamadas. Cuando
+ * aparece o se rompe una pared solo se reparan los estados cuyas transiciones
+ * cambiaron, y cuando el jugador avanza basta con ajustar km.
+ */
+class IncrementalPlanner
+{
+public:
+    static constexpr int MAX_ENERGY = model::Player::MAX_ENERGY;
+    static constexpr int ENERGY_LEVELS = MAX_ENERGY + 1;
+
+    PathfindingResult plan(model::HexGrid& grid,
+                           int startRow, int startCol,
+                           int goalRow, int goalCol,
+                           int initialEnergy);
+
+    void reset();
+
+    const PlannerStats& stats() const { return m_stats; }
+
+private:
+    struct Key
+    {
+        int primary;
+        int secondary;
+
+        bool operator<(const Key& other) const
+        {
+            return primary < other.primary || (primary == other.primary && secondary < other.secondary);
+        }
+    };
+
+    struct QueueEntry
+    {
+        Key key;
+        int state;
+    };
+
+    static bool queueAfter(const QueueEntry& a, const QueueEntry& b) { return b.key < a.key; }
+
+    int stateIndex(int cell, int energy) const { return cell * ENERGY_LEVELS + energy; }
+    int cellOf(int state) const { return m_transitions.cellOf(state); }
+
+    void initialize(model::HexGrid& grid, int goalRow, int goalCol);
+    void applyChanges(model::HexGrid& grid);
+
+    int heuristic(int fromCell, int toCell) const;
+    Key calculateKey(int state) const;
+    int bestSuccessorCost(int state, int* bestState) const;
+    void updateVertex(int state);
+    void computeShortestPath();
+    bool topIsBefore(const Key& key);
+
+    template <typename Visitor> void forEachSuccessor(int state, Visitor&& visit) const;
+    template <typename Visitor> void forEachPredecessor(int state, Visitor&& visit) const;
+
+    model::HexGrid* m_grid = nullptr;
+    int m_rows = 0;
+    int m_cols = 0;
+    int m_slideReach = 1;
+    int m_startState = -1;
+    int m_lastStartCell = -1;
+    int m_km = 0;
+
+    std::vector<int> m_g;
+    std::vector<int> m_rhs;
+    std::vector<QueueEntry> m_queue;
+
+    // Copia del grid en la ultima planificacion, para detectar cambios.
+    unsigned long long m_version = 0;
+    std::vector<model::CellType> m_types;
+    StateTransitions m_transitions;
+
+    PlannerStats m_stats;
+};
+
+}
+
+#endif
@@ -0,0 +1,87 @@
+#include "PathCache.hpp"
+#include "../model/Player.hpp"
+#include "../utils/Profiler.hpp"
+#include <algorithm>
+
+using namespace model;
+
+namespace core {
+
+namespace {
+
+constexpr int MAX_ENERGY = Player::MAX_ENERGY;
+
+}
+
+PathCache::PathCache(std::size_t capacity)
+    : m_capacity(std::max<std::size_t>(capacity, 1))
+{
+}
+
+std::size_t PathCache::KeyHash::operator()(const PathKey& key) const
+{
+    // El hash del grid ya esta bien mezclado; el resto solo se combina encima.
+    std::uint64_t h = key.gridHash;
+    h ^= (static_cast<std::uint64_t>(key.startCell) << 32 | static_cast<std::uint32_t>(key.goalCell)) * 0x9E3779B97F4A7C15ULL;
+    h ^= static_cast<std::uint64_t>(key.energy) * 0xBF58476D1CE4E5B9ULL;
+    h ^= static_cast<std::uint64_t>(key.cols) << 40;
+    return static_cast<std::size_t>(h ^ (h >> 29));
+}
+
+PathKey PathCache::keyFor(const HexGrid& grid,
+                          int startRow, int startCol,
+                          int goalRow, int goalCol,
+                          int energy)
+{
+    return PathKey{ grid.hash(), grid.rows(), grid.cols(),
+                    grid.index(startRow, startCol),
+                    std::min(energy, MAX_ENERGY),
+                    grid.index(goalRow, goalCol) };
+}
+
+PathCache& PathCache::local()
+{
+    static thread_local PathCache cache;
+    return cache;
+}
+
+const PathfindingResult* PathCache::find(const PathKey& key)
+{
+    auto it = m_index.find(key);
+    bool hit = it != m_index.end();
+    utils::Profiler::countPathCache(hit);
+
+    if (!hit) {
+        ++m_misses;
+        return nullptr;
+    }
+
+    ++m_hits;
+    m_entries.splice(m_entries.begin(), m_entries, it->second);
+    return &it->second->second;
+}
+
+void PathCache::store(const PathKey& key, const PathfindingResult& result)
+{
+    auto it = m_index.find(key);
+    if (it != m_index.end()) {
+        it->second->second = result;
+        m_entries.splice(m_entries.begin(), m_entries, it->second);
+        return;
+    }
+
+    if (m_entries.size() >= m_capacity) {
+        m_index.erase(m_entries.back().first);
+        m_entries.pop_back();
+    }
+    m_entries.emplace_front(key, result);
+    m_index.emplace(key, m_entries.begin());
+}
+
+void PathCache::clear()
+{
+    m_entries.clear();
+    m_index.clear();
+}
+
+}
@@ -0,0 +1,85 @@
+#ifndef PATHCACHE_HPP
+#define PATHCACHE_HPP
+
+#include "../model/HexGrid.hpp"
+#include "PathFinding.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <unordered_map>
+#include <utility>
+
+namespace core {
+
+// Todo lo que decide el resultado de una busqueda: el contenido del grid
+// (por su hash Zobrist y su tamano), el inicio, la energia y la meta.
+struct PathKey
+{
+    std::uint64_t gridHash;
+    int rows, cols;
+    int startCell;
+    int energy;
+    int goalCell;
+
+    bool operator==(const PathKey& other) const
+    {
+        return gridHash == other.gridHash && rows == other.rows && cols == other.cols &&
+            startCell == other.startCell && energy == other.energy && goalCell == other.goalCell;
+    }
+};
+
+/**
+ * @brief Resultados de busquedas recientes, con desalojo LRU.
+ *
+ * Pulsar P, ESC y R en la misma posicion, o recalcular en un estado ya
+ * resuelto, cuesta una busqueda en la tabla en lugar de un A*. La clave usa
+ * el hash del grid y no su version, asi que tambien acierta si el tablero
+ * volvio a un contenido anterior.
+ *
+ * No es thread-safe: cada hilo usa la suya (local()).
+ */
+class PathCache
+{
+public:
+    static constexpr std::size_t DEFAULT_CAPACITY = 64;
+
+    explicit PathCache(std::size_t capacity = DEFAULT_CAPACITY);
+
+    static PathKey keyFor(const model::HexGrid& grid,
+                          int startRow, int startCol,
+                          int goalRow, int goalCol,
+                          int energy);
+
+    // Cache del hilo actual; la comparten los solvers del juego y findPathCached.
+    static PathCache& local();
+
+    // nullptr si no esta. Un acierto pasa la entrada al frente; cada consulta
+    // se cuenta tambien en el profiler del hilo, si hay uno.
+    const PathfindingResult* find(const PathKey& key);
+
+    void store(const PathKey& key, const PathfindingResult& result);
+
+    void clear();
+
+    std::size_t size() const { return m_entries.size(); }
+    std::size_t hits() const { return m_hits; }
+    std::size_t misses() const { return m_misses; }
+
+private:
+    struct KeyHash
+    {
+        std::size_t operator()(const PathKey& key) const;
+    };
+
+    using Entry = std::pair<PathKey, PathfindingResult>;
+
+    std::size_t m_capacity;
+    std::list<Entry> m_entries;   // de la mas reciente a la mas vieja
+    std::unordered_map<PathKey, std::list<Entry>::iterator, KeyHash> m_index;
+    std::size_t m_hits = 0;
+    std::size_t m_misses = 0;
+};
+
+}
+
+#endif
@@ -1,81 +1,19 @@
 #include "PathFinding.hpp"
+#include "AStarSearch.hpp"
+#include "IncrementalPlanner.hpp"
+#include "PathCache.hpp"
 #include "model/HexGrid.hpp"
-#include "../utils/Utils.hpp"
-#include <queue>
+#include "utils/Profiler.hpp"
 #include <tuple>
-#include <map>
-#include <set>
+#include <unordered_set>
 #include <algorithm>
 
 constexpr int MAX_ENERGY = 10;
 
-struct State {
-    int row, col;
-    int energy;
-    int cost;
-
-    bool operator>(const State& other) const {
-        return cost > other.cost;
-    }
-};
-
-std::pair<int, int> getTransportDirection(model::CellType type, int row) {
-    bool isOddRow = row % 2 != 0;
-   
-    switch (type) {
-    case model::CellType::UP_RIGHT:
-        return { -1, isOddRow ? 1 : 0 };
-    case model::CellType::RIGHT:
-        return { 0, 1 };
-    case model::CellType::DOWN_RIGHT:
-        return { 1, isOddRow ? 1 : 0 };
-    case model::CellType::DOWN_LEFT:
-        return { 1, isOddRow ? 0 : -1 };
-    case model::CellType::LEFT:
-        return { 0, -1 };
-    case model::CellType::UP_LEFT:
-        return { -1, isOddRow ? 0 : -1 };
-    default:
-        return { 0, 0 };
-    }
-}
-
 std::tuple<int, int, int> slideThroughBands(model::HexGrid& grid, int row, int col, int energy) {
-    while (true) {
-        const auto& cell = grid.at(row, col);
-        auto type = cell.type;
-       
-        if (type == model::CellType::GOAL) {
-            break;
-        }
-       
-        if (!(type >= model::CellType::UP_RIGHT && type <= model::CellType::DOWN_LEFT)) {
-            break;
-        }
-
-        auto offset = getTransportDirection(type, row);
-        int nr = row + offset.first;
-        int nc = col + offset.second;
-
-        if (!grid.inBounds(nr, nc)) {
-            break;
-        }
+    model::ConveyorJump jump = grid.conveyors().jump(grid.index(row, col));
 
-        const auto& targetCell = grid.at(nr, nc);
-        if (targetCell.type == model::CellType::WALL) {
-            break;
-        }
-
-        energy = std::min(energy + 1, MAX_ENERGY);
-        row = nr;
-        col = nc;
-        
-        if (grid.at(row, col).type == model::CellType::GOAL) {
-            break;
-        }
-    }
-
-    return { row, col, energy };
+    return { jump.target / grid.cols(), jump.target % grid.cols(), std::min(energy + jump.gain, MAX_ENERGY) };
 }
 
 std::vector<std::pair<int, int> > getStepByStepPath(
@@ -86,8 +24,16 @@ std::vector<std::pair<int, int> > getStepByStepPath(
     std::vector<std::pair<int, int> > completePath;
    
     if (keyPoints.empty()) return completePath;
+
+    // Cada celda aparece una sola vez en el camino; el conjunto evita recorrerlo en cada paso.
+    std::unordered_set<int> added;
+    auto addOnce = [&](int row, int col) {
+        if (added.insert(grid.index(row, col)).second) {
+            completePath.push_back({row, col});
+        }
+    };
    
-    completePath.push_back(keyPoints[0]);
+    addOnce(keyPoints[0].first, keyPoints[0].second);
    
     for (size_t i = 0; i < keyPoints.size() - 1; ++i) {
         int currentRow = keyPoints[i].first;
@@ -96,100 +42,38 @@ std::vector<std::pair<int, int> > getStepByStepPath(
         int targetCol = keyPoints[i + 1].second;
        
         if (grid.at(targetRow, targetCol).type == model::CellType::GOAL) {
-            bool metaAlreadyAdded = false;
-            for (const auto& point : completePath) {
-                if (point.first == targetRow && point.second == targetCol) {
-                    metaAlreadyAdded = true;
-                    break;
-                }
-            }
-            
-            if (!metaAlreadyAdded) {
-                completePath.push_back({targetRow, targetCol});
-            }
+            addOnce(targetRow, targetCol);
             continue;
         }
        
-        model::HexCell& cell = grid.at(currentRow, currentCol);
-        bool foundPath = false;
+        model::HexCell cell = grid.at(currentRow, currentCol);
        
-        for (model::HexCell* neighbor : grid.neighbors(cell)) {
-            int nr = neighbor->row;
-            int nc = neighbor->col;
+        for (const model::HexCell& neighbor : grid.neighbors(cell)) {
+            int nr = neighbor.row;
+            int nc = neighbor.col;
            
             if (nr == targetRow && nc == targetCol) {
-                bool alreadyAdded = false;
-                for (const auto& point : completePath) {
-                    if (point.first == nr && point.second == nc) {
-                        alreadyAdded = true;
-                        break;
-                    }
-                }
-                
-                if (!alreadyAdded) {
-                    completePath.push_back({nr, nc});
-                }
-                foundPath = true;
+                addOnce(nr, nc);
                 break;
             }
            
             auto [finalR, finalC, finalE] = slideThroughBands(grid, nr, nc, 0);
            
             if (finalR == targetRow && finalC == targetCol) {
-                bool firstStepAdded = false;
-                for (const auto& point : completePath) {
-                    if (point.first == nr && point.second == nc) {
-                        firstStepAdded = true;
-                        break;
-                    }
-                }
-                
-                if (!firstStepAdded) {
-                    completePath.push_back({nr, nc});
-                }
+                addOnce(nr, nc);
                
-                int tempRow = nr, tempCol = nc;
+                const model::ConveyorTable& conveyors = grid.conveyors();
+                int temp = grid.index(nr, nc);
+                int target = grid.index(targetRow, targetCol);
                
-                while (true) {
-                    const auto& tempCell = grid.at(tempRow, tempCol);
-                    auto tempType = tempCell.type;
-                   
-                    if (!(tempType >= model::CellType::UP_RIGHT && tempType <= model::CellType::DOWN_LEFT)) {
-                        break;
-                    }
-                   
-                    auto offset = getTransportDirection(tempType, tempRow);
-                    int newTempRow = tempRow + offset.first;
-                    int newTempCol = tempCol + offset.second;
-                   
-                    if (!grid.inBounds(newTempRow, newTempCol)) {
-                        break;
-                    }
-                    if (grid.at(newTempRow, newTempCol).type == model::CellType::WALL) {
-                        break;
-                    }
-                   
-                    tempRow = newTempRow;
-                    tempCol = newTempCol;
-                    
-                    bool stepAlreadyAdded = false;
-                    for (const auto& point : completePath) {
-                        if (point.first == tempRow && point.second == tempCol) {
-                            stepAlreadyAdded = true;
-                            break;
-                        }
-                    }
-                    
-                    if (!stepAlreadyAdded) {
-                        completePath.push_back({tempRow, tempCol});
-                    }
-                   
-                    if (tempRow == targetRow && tempCol == targetCol) {
+                while (temp != target) {
+                    temp = conveyors.next(grid, temp);
+                    if (temp < 0) {
                         break;
                     }
+                    addOnce(temp / grid.cols(), temp % grid.cols());
                 }
                
-                foundPath = true;
                 break;
             }
         }
@@ -204,119 +88,43 @@ PathfindingResult findPath(
     int goalRow, int goalCol,
     int initialEnergy
 ) {
-    std::priority_queue<State, std::vector<State>, std::greater<State> > openSet;
-    std::map<std::tuple<int, int, int>, std::tuple<int, int, int> > cameFrom;
-    std::set<std::tuple<int, int, int> > visited;
+    utils::ScopedTimer timer(utils::FramePhase::Pathfinding);
 
-    int actualStartRow = startRow;
-    int actualStartCol = startCol;
-    int actualStartEnergy = initialEnergy;
-    
-    if (grid.at(startRow, startCol).type != model::CellType::GOAL) {
-        auto startResult = slideThroughBands(grid, startRow, startCol, initialEnergy);
-        actualStartRow = std::get<0>(startResult);
-        actualStartCol = std::get<1>(startResult);
-        actualStartEnergy = std::get<2>(startResult);
-    }
-
-    openSet.push(State{actualStartRow, actualStartCol, actualStartEnergy, 0});
-    visited.insert(std::make_tuple(actualStartRow, actualStartCol, actualStartEnergy));
+    // Un motor por hilo: sus arreglos planos se reutilizan entre busquedas.
+    static thread_local core::AStarSearch search;
 
-    while (!openSet.empty()) {
-        State current = openSet.top();
-        openSet.pop();
+    search.begin(grid, startRow, startCol, goalRow, goalCol, initialEnergy);
+    search.run();
+    return search.result();
+}
 
-        model::HexCell& cell = grid.at(current.row, current.col);
-        for (model::HexCell* neighbor : grid.neighbors(cell)) {
-            int nr = neighbor->row;
-            int nc = neighbor->col;
-            int newEnergy = std::min(current.energy + 1, MAX_ENERGY);
+PathfindingResult findPathIncremental(
+    model::HexGrid& grid,
+    int startRow, int startCol,
+    int goalRow, int goalCol,
+    int initialEnergy
+) {
+    utils::ScopedTimer timer(utils::FramePhase::Pathfinding);
 
-            if (neighbor->type == model::CellType::WALL) {
-                if (current.energy < MAX_ENERGY) {
-                    continue;
-                }
-                newEnergy = 0;
-            }
+    static thread_local core::IncrementalPlanner planner;
 
-            if (nr == goalRow && nc == goalCol && neighbor->type == model::CellType::GOAL) {
-                std::vector<std::pair<int, int> > keyPoints;
-                std::tuple<int, int, int> key = std::make_tuple(current.row, current.col, current.energy);
-                
-                while (cameFrom.count(key)) {
-                    std::tuple<int, int, int> prev = cameFrom[key];
-                    keyPoints.push_back(std::make_pair(std::get<0>(key), std::get<1>(key)));
-                    key = prev;
-                }
-                keyPoints.push_back(std::make_pair(actualStartRow, actualStartCol));
-                std::reverse(keyPoints.begin(), keyPoints.end());
-                
-                keyPoints.push_back(std::make_pair(nr, nc));
-                
-                std::vector<std::pair<int, int> > completePath = getStepByStepPath(grid, keyPoints, initialEnergy);
-                
-                std::vector<model::HexCell*> path;
-                for (const auto& point : completePath) {
-                    path.push_back(&grid.at(point.first, point.second));
-                }
-                
-                if (path.empty() || path.back()->row != goalRow || path.back()->col != goalCol) {
-                    path.push_back(&grid.at(goalRow, goalCol));
-                }
-                
-                return PathfindingResult{path, true};
-            }
-
-            int finalR = nr;
-            int finalC = nc;
-            int finalEnergy = newEnergy;
-            
-            if (neighbor->type != model::CellType::GOAL) {
-                auto result = slideThroughBands(grid, nr, nc, newEnergy);
-                finalR = std::get<0>(result);
-                finalC = std::get<1>(result);
-                finalEnergy = std::get<2>(result);
-                
-                if (finalR == goalRow && finalC == goalCol) {
-                    std::vector<std::pair<int, int> > keyPoints;
-                    std::tuple<int, int, int> key = std::make_tuple(current.row, current.col, current.energy);
-                    
-                    while (cameFrom.count(key)) {
-                        std::tuple<int, int, int> prev = cameFrom[key];
-                        keyPoints.push_back(std::make_pair(std::get<0>(key), std::get<1>(key)));
-                        key = prev;
-                    }
-                    keyPoints.push_back(std::make_pair(actualStartRow, actualStartCol));
-                    std::reverse(keyPoints.begin(), keyPoints.end());
-                    
-                    keyPoints.push_back(std::make_pair(finalR, finalC));
-                    
-                    std::vector<std::pair<int, int> > completePath = getStepByStepPath(grid, keyPoints, initialEnergy);
-                    
-                    std::vector<model::HexCell*> path;
-                    for (const auto& point : completePath) {
-                        path.push_back(&grid.at(point.first, point.second));
-                    }
-                    
-                    if (path.empty() || path.back()->row != goalRow || path.back()->col != goalCol) {
-                        path.push_back(&grid.at(goalRow, goalCol));
-                    }
-                    
-                    return PathfindingResult{path, true};
-                }
-            }
-           
-            std::tuple<int, int, int> key = std::make_tuple(finalR, finalC, finalEnergy);
+    return planner.plan(grid, startRow, startCol, goalRow, goalCol, initialEnergy);
+}
 
-            if (visited.count(key)) {
-                continue;
-            }
-            visited.insert(key);
+PathfindingResult findPathCached(
+    model::HexGrid& grid,
+    int startRow, int startCol,
+    int goalRow, int goalCol,
+    int initialEnergy
+) {
+    core::PathCache& cache = core::PathCache::local();
+    core::PathKey key = core::PathCache::keyFor(grid, startRow, startCol, goalRow, goalCol, initialEnergy);
 
-            openSet.push(State{finalR, finalC, finalEnergy, current.cost + 1});
-            cameFrom[key] = std::make_tuple(current.row, current.col, current.energy);
-        }
+    if (const PathfindingResult* cached = cache.find(key)) {
+        return *cached;
     }
 
-    return PathfindingResult{std::vector<model::HexCell*>(), false};
-}
\ No newline at end of file
+    PathfindingResult result = findPathIncremental(grid, startRow, startCol, goalRow, goalCol, initialEnergy);
+    cache.store(key, result);
+    return result;
+}
@@ -2,16 +2,44 @@
 #include "model/HexCell.hpp" 
 #include "model/HexGrid.hpp" 
 #include <vector>
+#include <tuple>
+#include <utility>
 
 
 struct PathfindingResult {
-    std::vector<model::HexCell*> path;
-    bool success;
+    std::vector<model::HexCell> path;
+    bool success = false;
 };
 
+std::tuple<int, int, int> slideThroughBands(model::HexGrid& grid, int row, int col, int energy);
+
+std::vector<std::pair<int, int> > getStepByStepPath(
+    model::HexGrid& grid,
+    const std::vector<std::pair<int, int> >& keyPoints,
+    int initialEnergy
+);
+
 PathfindingResult findPath(
     model::HexGrid& grid,
     int startRow, int startCol,
     int goalRow, int goalCol,
     int initialEnergy
 );
+
+// Igual que findPath, pero reutiliza el estado de busqueda de la llamada anterior
+// (D* Lite): tras una pared nueva o rota solo repara la zona afectada.
+PathfindingResult findPathIncremental(
+    model::HexGrid& grid,
+    int startRow, int startCol,
+    int goalRow, int goalCol,
+    int initialEnergy
+);
+
+// findPathIncremental detras de la cache de caminos del hilo (core::PathCache):
+// una consulta repetida sobre el mismo contenido del grid no vuelve a buscar.
+PathfindingResult findPathCached(
+    model::HexGrid& grid,
+    int startRow, int startCol,
+    int goalRow, int goalCol,
+    int initialEnergy
+);
@@ -0,0 +1,57 @@
+#include "Simulation.hpp"
+#include "GameLogic.hpp"
+#include <utility>
+
+using namespace model;
+
+namespace core {
+
+Simulation::Simulation(HexGrid grid,
+                       int startRow, int startCol,
+                       int goalRow, int goalCol,
+                       std::uint64_t seed,
+                       int turnsPerWall)
+    : m_grid(std::move(grid)),
+      m_player(startRow, startCol, m_clock),
+      m_turns(seed, turnsPerWall),
+      m_goalRow(goalRow),
+      m_goalCol(goalCol)
+{
+    m_player.movementDuration = 0.0f;
+    m_turns.rebuildFreeCells(m_grid);
+}
+
+StepResult Simulation::step(const Action& action)
+{
+    StepResult result;
+    if (m_player.hasWon) {
+        result.won = true;
+        return result;
+    }
+
+    int oldRow = m_player.row;
+    int oldCol = m_player.col;
+    unsigned long long oldVersion = m_grid.version();
+    bool wasSelecting = m_player.isSelectingWall;
+
+    applyAction(action, m_player, m_grid, m_turns);
+
+    result.brokeWall = wasSelecting && !m_player.isSelectingWall && m_grid.version() != oldVersion;
+    result.moved = m_player.row != oldRow || m_player.col != oldCol;
+    if (result.moved) {
+        m_clock.advance(SECONDS_PER_CELL);
+    }
+
+    // Las bandas no tienen ciclos activos (la tabla los vuelve inertes), asi que esto termina.
+    while (handleConveyorMovement(m_player, m_grid)) {
+        ++result.conveyorSteps;
+        m_clock.advance(SECONDS_PER_CELL);
+    }
+    result.moved = result.moved || result.conveyorSteps > 0;
+    result.won = m_player.hasWon;
+
+    ++m_steps;
+    return result;
+}
+
+}
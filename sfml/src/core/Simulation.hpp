@@ -0,0 +1,71 @@
+#ifndef SIMULATION_HPP
+#define SIMULATION_HPP
+
+#include "../model/GameClock.hpp"
+#include "../model/HexGrid.hpp"
+#include "../model/Player.hpp"
+#include "Action.hpp"
+#include "TurnSystem.hpp"
+#include <cstdint>
+
+namespace core {
+
+struct StepResult
+{
+    bool moved = false;       // el jugador cambio de celda (a pie o por bandas)
+    bool brokeWall = false;
+    bool won = false;
+    int conveyorSteps = 0;
+};
+
+/**
+ * @brief Partida completa sin ventana: grid, jugador, turnos y un reloj virtual.
+ *
+ * Usa las mismas reglas que el juego con SFML (applyAction y
+ * handleConveyorMovement), pero sin animaciones: cada step() aplica la
+ * accion, sigue las bandas hasta que el jugador se detiene y avanza el
+ * reloj virtual lo que habria durado la animacion. Para correr muchas
+ * partidas conviene apagar los mensajes con setGameLogEnabled(false).
+ */
+class Simulation
+{
+public:
+    // Segundos virtuales que cuesta cada celda recorrida (igual que la animacion del juego).
+    static constexpr double SECONDS_PER_CELL = 0.3;
+
+    Simulation(model::HexGrid grid,
+               int startRow, int startCol,
+               int goalRow, int goalCol,
+               std::uint64_t seed,
+               int turnsPerWall = TurnSystem::DEFAULT_TURNS_PER_WALL);
+
+    // El jugador guarda un puntero al reloj de la simulacion.
+    Simulation(const Simulation&) = delete;
+    Simulation& operator=(const Simulation&) = delete;
+
+    StepResult step(const Action& action);
+
+    const model::HexGrid& grid() const { return m_grid; }
+    model::HexGrid& grid() { return m_grid; }
+    const model::Player& player() const { return m_player; }
+    const TurnSystem& turns() const { return m_turns; }
+    const model::ManualClock& clock() const { return m_clock; }
+
+    int goalRow() const { return m_goalRow; }
+    int goalCol() const { return m_goalCol; }
+    bool finished() const { return m_player.hasWon; }
+    std::uint64_t steps() const { return m_steps; }
+
+private:
+    model::ManualClock m_clock;
+    model::HexGrid m_grid;
+    model::Player m_player;
+    TurnSystem m_turns;
+    int m_goalRow;
+    int m_goalCol;
+    std::uint64_t m_steps = 0;
+};
+
+}
+
+#endif
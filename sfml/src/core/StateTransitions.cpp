@@ -0,0 +1,56 @@
+#include "StateTransitions.hpp"
+
+using namespace model;
+
+namespace core {
+
+void StateTransitions::build(const HexGrid& grid, const std::vector<CellType>& types, int goalCell)
+{
+    m_cellCount = grid.rows() * grid.cols();
+    m_goalCell = goalCell;
+    m_sink = m_cellCount * ENERGY_LEVELS;
+
+    const ConveyorTable& conveyors = grid.conveyors();
+    m_slideTarget.resize(m_cellCount);
+    m_slideGain.resize(m_cellCount);
+    for (int cell = 0; cell < m_cellCount; ++cell) {
+        ConveyorJump jump = conveyors.jump(cell);
+        m_slideTarget[cell] = jump.target;
+        m_slideGain[cell] = jump.gain;
+    }
+    buildReverseSlides(types);
+}
+
+bool StateTransitions::updateSlide(int cell, ConveyorJump jump)
+{
+    if (jump.target == m_slideTarget[cell] && jump.gain == m_slideGain[cell]) {
+        return false;
+    }
+    m_slideTarget[cell] = jump.target;
+    m_slideGain[cell] = jump.gain;
+    return true;
+}
+
+void StateTransitions::buildReverseSlides(const std::vector<CellType>& types)
+{
+    m_reverseStart.assign(m_cellCount + 1, 0);
+
+    for (int cell = 0; cell < m_cellCount; ++cell) {
+        if (types[cell] != CellType::WALL) {
+            ++m_reverseStart[m_slideTarget[cell] + 1];
+        }
+    }
+    for (int cell = 0; cell < m_cellCount; ++cell) {
+        m_reverseStart[cell + 1] += m_reverseStart[cell];
+    }
+
+    m_reverseCells.resize(m_reverseStart[m_cellCount]);
+    std::vector<int> fill(m_reverseStart.begin(), m_reverseStart.end() - 1);
+    for (int cell = 0; cell < m_cellCount; ++cell) {
+        if (types[cell] != CellType::WALL) {
+            m_reverseCells[fill[m_slideTarget[cell]]++] = cell;
+        }
+    }
+}
+
+}
@@ -0,0 +1,135 @@
+#ifndef STATETRANSITIONS_HPP
+#define STATETRANSITIONS_HPP
+
+#include "../model/HexGrid.hpp"
+#include "../model/Player.hpp"
+#include <algorithm>
+#include <vector>
+
+namespace core {
+
+/**
+ * @brief Transiciones entre estados (celda, energia) para las busquedas hacia atras.
+ *
+ * Un movimiento entra a una celda vecina y sigue sus bandas hasta el final,
+ * ganando energia; a una pared solo se entra rompiendola con la energia llena,
+ * y se queda en 0. Llegar a la meta, directo o deslizandose, lleva al sumidero.
+ *
+ * Guarda las bandas de cada celda y su indice inverso. Los tipos de celda se
+ * pasan en cada recorrido: IncrementalPlanner usa su copia del ultimo plan y
+ * DistanceField el buffer del grid.
+ */
+class StateTransitions
+{
+public:
+    static constexpr int MAX_ENERGY = model::Player::MAX_ENERGY;
+    static constexpr int ENERGY_LEVELS = MAX_ENERGY + 1;
+
+    // Lee las bandas del grid y arma el indice inverso con `types`.
+    void build(const model::HexGrid& grid, const std::vector<model::CellType>& types, int goalCell);
+
+    // Cambia la banda de una celda; true si era distinta. Despues de cambiar
+    // bandas o tipos hay que volver a llamar a buildReverseSlides().
+    bool updateSlide(int cell, model::ConveyorJump jump);
+    void buildReverseSlides(const std::vector<model::CellType>& types);
+
+    int stateIndex(int cell, int energy) const { return cell * ENERGY_LEVELS + energy; }
+    int cellOf(int state) const { return state == m_sink ? m_goalCell : state / ENERGY_LEVELS; }
+
+    int goalCell() const { return m_goalCell; }
+    int sink() const { return m_sink; }
+
+    // visit(siguiente, celda a la que se entro) por cada movimiento desde `state`.
+    template <typename Visitor>
+    void forEachSuccessor(const model::HexGrid& grid, const std::vector<model::CellType>& types,
+                          int state, Visitor&& visit) const;
+
+    // visit(anterior) por cada estado con un movimiento hacia `state`.
+    template <typename Visitor>
+    void forEachPredecessor(const model::HexGrid& grid, const std::vector<model::CellType>& types,
+                            int state, Visitor&& visit) const;
+
+private:
+    int m_cellCount = 0;
+    int m_goalCell = -1;
+    int m_sink = -1;
+
+    std::vector<int> m_slideTarget;
+    std::vector<int> m_slideGain;
+
+    // Celdas cuyo deslizamiento termina en cada celda.
+    std::vector<int> m_reverseStart;
+    std::vector<int> m_reverseCells;
+};
+
+template <typename Visitor>
+void StateTransitions::forEachSuccessor(const model::HexGrid& grid, const std::vector<model::CellType>& types,
+                                        int state, Visitor&& visit) const
+{
+    int cell = state / ENERGY_LEVELS;
+    int energy = state % ENERGY_LEVELS;
+
+    grid.forEachNeighbor(cell, [&](int neighbor) {
+        if (types[neighbor] == model::CellType::WALL) {
+            if (energy == MAX_ENERGY) {
+                visit(stateIndex(neighbor, 0), neighbor);
+            }
+            return;
+        }
+
+        int target = m_slideTarget[neighbor];
+        if (target == m_goalCell) {
+            visit(m_sink, neighbor);
+            return;
+        }
+        visit(stateIndex(target, std::min(energy + 1 + m_slideGain[neighbor], MAX_ENERGY)), neighbor);
+    });
+}
+
+template <typename Visitor>
+void StateTransitions::forEachPredecessor(const model::HexGrid& grid, const std::vector<model::CellType>& types,
+                                          int state, Visitor&& visit) const
+{
+    bool toSink = state == m_sink;
+    int cell = cellOf(state);
+    int energy = toSink ? 0 : state % ENERGY_LEVELS;
+
+    if (!toSink && cell == m_goalCell) {
+        return;
+    }
+
+    if (types[cell] == model::CellType::WALL) {
+        if (energy == 0) {
+            grid.forEachNeighbor(cell, [&](int from) { visit(stateIndex(from, MAX_ENERGY)); });
+        }
+        return;
+    }
+
+    for (int k = m_reverseStart[cell]; k < m_reverseStart[cell + 1]; ++k) {
+        int entered = m_reverseCells[k];
+        int gain = m_slideGain[entered];
+
+        grid.forEachNeighbor(entered, [&](int from) {
+            if (toSink) {
+                for (int e = 0; e <= MAX_ENERGY; ++e) {
+                    visit(stateIndex(from, e));
+                }
+            }
+            else if (energy < MAX_ENERGY) {
+                int e = energy - 1 - gain;
+                if (e >= 0) {
+                    visit(stateIndex(from, e));
+                }
+            }
+            else {
+                for (int e = std::max(0, MAX_ENERGY - 1 - gain); e <= MAX_ENERGY; ++e) {
+                    visit(stateIndex(from, e));
+                }
+            }
+        });
+    }
+}
+
+}
+
+#endif
@@ -1,51 +1,114 @@
 #include "TurnSystem.hpp"
-#include <cstdlib>
-#include <ctime>
+#include <chrono>
+#include <random>
 
 using namespace std;
 using namespace model;
 
-int TurnSystem::turnCounter = 0;
-const int TurnSystem::TURNS_PER_WALL;
-bool TurnSystem::randomInitialized = false;
+uint64_t TurnSystem::randomSeed() {
+    random_device device;
+    uint64_t high = device();
+    uint64_t time = static_cast<uint64_t>(chrono::steady_clock::now().time_since_epoch().count());
+    return (high << 32) ^ device() ^ time;
+}
+
+TurnSystem::TurnSystem(uint64_t initialSeed, int wallEvery)
+    : turnsPerWall(wallEvery > 0 ? wallEvery : 0), seed(initialSeed), rng(initialSeed) {
+}
+
+void TurnSystem::addEmptyCell(int index) {
+    if (emptySlot[index] >= 0)
+        return;
+
+    emptySlot[index] = static_cast<int>(emptyCells.size());
+    emptyCells.push_back(index);
+}
+
+void TurnSystem::removeEmptyCell(int index) {
+    int slot = emptySlot[index];
+    if (slot < 0)
+        return;
 
-void TurnSystem::initializeRandom() {
-    if (!randomInitialized) {
-        srand(static_cast<unsigned int>(time(nullptr)));
-        randomInitialized = true;
+    int last = emptyCells.back();
+    emptyCells[slot] = last;
+    emptySlot[last] = slot;
+    emptyCells.pop_back();
+    emptySlot[index] = -1;
+}
+
+void TurnSystem::rebuildFreeCells(const HexGrid &grid) {
+    const vector<CellType> &types = grid.types();
+
+    emptyCells.clear();
+    emptyCells.reserve(types.size());
+    emptySlot.assign(types.size(), -1);
+
+    for (int i = 0; i < static_cast<int>(types.size()); ++i) {
+        if (types[i] == CellType::EMPTY)
+            addEmptyCell(i);
     }
+    syncedVersion = grid.version();
 }
 
-vector<pair<int, int>> TurnSystem::findAvailableCells(const HexGrid &grid, const Player &player) {
-    vector<pair<int, int>> availableCells;
-   
-    for (int row = 0; row < grid.rows(); ++row) {
-        for (int col = 0; col < grid.cols(); ++col) {
-            const HexCell &cell = grid.at(row, col);
-           
-            if (cell.type == CellType::EMPTY &&
-                !(row == player.row && col == player.col)) {
-                availableCells.push_back({row, col});
-            }
-        }
+void TurnSystem::onCellChanged(const HexGrid &grid, int row, int col) {
+    if (emptySlot.size() != grid.types().size()) {
+        rebuildFreeCells(grid);
+        return;
     }
-   
-    return availableCells;
+
+    int index = grid.index(row, col);
+    if (grid.type(row, col) == CellType::EMPTY)
+        addEmptyCell(index);
+    else
+        removeEmptyCell(index);
+    syncedVersion = grid.version();
+}
+
+void TurnSystem::syncFreeCells(const HexGrid &grid) {
+    if (emptySlot.size() != grid.types().size()) {
+        rebuildFreeCells(grid);
+        return;
+    }
+
+    bool journaled = grid.forEachChangeSince(syncedVersion, [this](const CellChange &change) {
+        if (change.newType == CellType::EMPTY)
+            addEmptyCell(change.cell);
+        else
+            removeEmptyCell(change.cell);
+    });
+
+    if (journaled)
+        syncedVersion = grid.version();
+    else
+        rebuildFreeCells(grid);
+}
+
+int TurnSystem::getFreeCellCount() const {
+    return static_cast<int>(emptyCells.size());
 }
 
 void TurnSystem::generateRandomWall(HexGrid &grid, const Player &player) {
-    initializeRandom();
-   
-    vector<pair<int, int>> availableCells = findAvailableCells(grid, player);
-   
-    if (availableCells.empty()) {
+    // Si alguien cambio el grid sin avisar, se ponen al dia las celdas libres antes de elegir.
+    syncFreeCells(grid);
+
+    // La celda del jugador no cuenta: se elige entre las demas y, si sale la
+    // del jugador, se toma la ultima del arreglo en su lugar.
+    int playerIndex = grid.index(player.row, player.col);
+    int candidates = static_cast<int>(emptyCells.size());
+    if (emptySlot[playerIndex] >= 0)
+        --candidates;
+
+    if (candidates <= 0) {
         return;
     }
-   
-    int randomIndex = rand() % availableCells.size();
-    auto [row, col] = availableCells[randomIndex];
-   
-    grid.at(row, col).type = CellType::WALL;
+
+    int chosen = emptyCells[rng.below(static_cast<uint32_t>(candidates))];
+    if (chosen == playerIndex)
+        chosen = emptyCells.back();
+
+    grid.setType(grid.rowOf(chosen), grid.colOf(chosen), CellType::WALL);
+    removeEmptyCell(chosen);
+    syncedVersion = grid.version();
 }
 
 void TurnSystem::handleTurn(HexGrid &grid, const Player &player) {
@@ -56,7 +119,7 @@ void TurnSystem::handleTurn(HexGrid &grid, const Player &player) {
     }
 }
 
-int TurnSystem::getCurrentTurnCount() {
+int TurnSystem::getCurrentTurnCount() const {
     return turnCounter;
 }
 
@@ -65,13 +128,18 @@ void TurnSystem::resetTurnCounter() {
 }
 
 void TurnSystem::setTurnsPerWall(int turns) {
-    // Funcion vacia - TURNS_PER_WALL es constante
+    turnsPerWall = turns > 0 ? turns : 0;
+}
+
+int TurnSystem::getTurnsPerWall() const {
+    return turnsPerWall;
 }
 
-int TurnSystem::getTurnsPerWall() {
-    return TURNS_PER_WALL;
+void TurnSystem::reseed(uint64_t newSeed) {
+    seed = newSeed;
+    rng.reseed(newSeed);
 }
 
-bool TurnSystem::shouldGenerateWall() {
-    return (turnCounter % TURNS_PER_WALL == 0);
-}
\ No newline at end of file
+bool TurnSystem::shouldGenerateWall() const {
+    return turnsPerWall > 0 && turnCounter % turnsPerWall == 0;
+}
@@ -4,6 +4,8 @@
 
 #include "../model/HexGrid.hpp"
 #include "../model/Player.hpp"
+#include "../utils/Random.hpp"
+#include <cstdint>
 #include <vector>
 #include <utility>
 
@@ -12,29 +14,61 @@ using namespace model;
 using namespace std;
 
 
+/**
+ * @brief Turnos y paredes aleatorias de una partida.
+ *
+ * Cada partida tiene su propia instancia con su generador; con la misma
+ * semilla y las mismas jugadas la secuencia de paredes es identica.
+ */
 class TurnSystem
 {
 private:
-    static int turnCounter;
-    static const int TURNS_PER_WALL = 5;
-    static bool randomInitialized;
+    int turnCounter = 0;
+    int turnsPerWall;
+    uint64_t seed;
+    Xoshiro256 rng;
 
-    static vector<pair<int, int>> findAvailableCells(const HexGrid &grid, const Player &player);
-    static void generateRandomWall(HexGrid &grid, const Player &player);
-    static void initializeRandom();
+    // Conjunto indexado de celdas EMPTY: arreglo con borrado por intercambio
+    // mas la posicion de cada celda en el arreglo (-1 si no esta).
+    vector<int> emptyCells;
+    vector<int> emptySlot;
+    unsigned long long syncedVersion = 0;
+
+    void addEmptyCell(int index);
+    void removeEmptyCell(int index);
+    // Aplica los cambios del diario del grid desde syncedVersion, o reconstruye si no alcanza.
+    void syncFreeCells(const HexGrid &grid);
+    void generateRandomWall(HexGrid &grid, const Player &player);
 
 
 public:
     static constexpr int ENERGY_PER_WALL_BREAK = 5;
-    static void handleTurn(HexGrid &grid, const Player &player);
+    static constexpr int DEFAULT_TURNS_PER_WALL = 5;
+
+    // Semilla no determinista para partidas normales.
+    static uint64_t randomSeed();
+
+    explicit TurnSystem(uint64_t seed = randomSeed(), int turnsPerWall = DEFAULT_TURNS_PER_WALL);
+
+    void handleTurn(HexGrid &grid, const Player &player);
+
+
+    int getCurrentTurnCount() const;
+    void resetTurnCounter();
+    // 0 desactiva las paredes aleatorias.
+    void setTurnsPerWall(int turns);
+    int getTurnsPerWall() const;
 
+    void reseed(uint64_t newSeed);
+    uint64_t getSeed() const { return seed; }
 
-    static int getCurrentTurnCount();
-    static void resetTurnCounter();
-    static void setTurnsPerWall(int turns);
-    static int getTurnsPerWall();
+    bool shouldGenerateWall() const;
 
-    static bool shouldGenerateWall();
+    // Reconstruye el conjunto de celdas libres (al cargar un mapa).
+    void rebuildFreeCells(const HexGrid &grid);
+    // Avisa que una celda cambio de tipo fuera del TurnSystem (p. ej. una pared rota).
+    void onCellChanged(const HexGrid &grid, int row, int col);
+    int getFreeCellCount() const;
 };
 
 
@@ -3,6 +3,7 @@
 #include "utils/MapLoader.hpp"
 #include "utils/Utils.hpp"
 #include "utils/MapSelector.hpp"
+#include "utils/KeyBindings.hpp"
 #include "model/HexCell.hpp"
 #include "model/HexGrid.hpp"
 #include "model/Player.hpp"
@@ -13,16 +14,47 @@
 #include "render/IntroScreen.hpp"
 #include "core/PathFinding.hpp"
 #include "core/AutoMovement.hpp"
+#include "core/AsyncSolver.hpp"
+#include "core/BudgetedSolver.hpp"
+#include "core/FixedTimestep.hpp"
+#include "model/GameClock.hpp"
+#include "utils/Profiler.hpp"
 #include <iostream>
+#include <optional>
 
 #define WINDOW_WIDTH 1400  
 #define WINDOW_HEIGHT 900  
 #define MAP_PATH "resources/map.txt"
 #define FONT_PATH "resources/arial.ttf"
+#define FRAME_RATE_LIMIT 60
+#define SIMULATION_TICK_RATE 60.0  // pasos de simulacion por segundo, independiente del render
+#define CAMERA_PAN_SPEED 12.0f  // pixeles por tick con una flecha pulsada
+#define PROFILE_CSV_PATH "hexescape_profile.csv"
 
 using namespace model;
 using namespace sf;
 
+// Sin hilos la busqueda se reparte entre frames, con un tramo fijo de cada uno.
+#ifdef HEXESCAPE_SINGLE_THREAD
+using GameSolver = core::BudgetedSolver;
+#else
+using GameSolver = core::AsyncSolver;
+#endif
+
+// Para que se pidio la busqueda que esta corriendo en GameSolver.
+enum class PendingSolve
+{
+    None,
+    Preview,    // P: mostrar el camino
+    AutoSolve,  // R: mostrar y ejecutar
+    Replan,     // el camino actual dejo de ser valido
+};
+
+static void requestSolve(GameSolver& solver, HexGrid& grid, const Player& player, const HexCell& goal)
+{
+    solver.request(grid, player.row, player.col, goal.row, goal.col, player.energy);
+}
+
 int main()
 {
     std::cout << "=== INICIANDO HEXESCAPE ===" << std::endl;
@@ -47,7 +79,7 @@ int main()
     RenderWindow window(VideoMode(WINDOW_WIDTH, WINDOW_HEIGHT),
                         "HexEscape: Fabrica de Rompecabezas Elite",
                         Style::Titlebar | Style::Close | Style::Resize);
-    window.setFramerateLimit(60);
+    window.setFramerateLimit(FRAME_RATE_LIMIT);
 
     Font font;
     if (!font.loadFromFile(FONT_PATH))
@@ -57,17 +89,38 @@ int main()
     }
 
     HexGrid* grid = nullptr;
-    HexCell* start = nullptr;
-    HexCell* goal = nullptr;
+    std::optional<HexCell> start;
+    std::optional<HexCell> goal;
+    TurnSystem turnSystem;
     Player* player = nullptr;
 
-    Text texto = createText(font, 16, Color::White);
-    CircleShape hexagon = createHexagon();
+    BoardRenderer boardRenderer;
+    Camera camera;
+
+    // La partida avanza con su propio reloj, un tick fijo por paso de simulacion,
+    // asi un frame lento no cambia la velocidad del juego.
+    ManualClock gameClock;
+    core::FixedTimestep timestep(SIMULATION_TICK_RATE);
+    Clock frameClock;
+
+    // Tiempos por fase del frame; solo se mide con la grafica visible (F3) o grabando el CSV (F4).
+    utils::Profiler profiler;
+    bool showProfiler = false;
 
     Clock animationClock;
     Clock backgroundClock;
     Clock victoryClock;
 
+    // Lo que se reinicia con cada mapa cargado: tablero, camara, animaciones y
+    // el tiempo acumulado del paso fijo.
+    auto onMapLoaded = [&]() {
+        timestep.reset();
+        boardRenderer.invalidate();
+        camera.reset();
+        animationClock.restart();
+        backgroundClock.restart();
+    };
+
     bool gameWon = false;
     bool showVictoryScreen = false;
     std::vector<std::pair<int, int>> pathCells; 
@@ -75,13 +128,25 @@ int main()
     bool showPathVisualization = false; 
     bool autoSolveMode = false;         
 
+    // Las busquedas de P, R y los recalculos corren fuera del bucle de eventos.
+    GameSolver solver;
+    PendingSolve pendingSolve = PendingSolve::None;
+
     int lastPlayerRow = -1;
     int lastPlayerCol = -1;
-    int lastTurnCount = 0;
-    bool pathNeedsUpdate = false;
+    // Version del grid con la que se reviso el camino por ultima vez.
+    unsigned long long pathCheckedVersion = 0;
 
     while (window.isOpen())
     {
+        bool profiling = showProfiler || profiler.recordingCsv();
+        utils::Profiler::setCurrent(profiling ? &profiler : nullptr);
+        if (profiling)
+        {
+            profiler.beginFrame();
+        }
+
+        utils::ScopedTimer eventsTimer(utils::FramePhase::Events);
         Event event;
         while (window.pollEvent(event))
         {
@@ -94,6 +159,11 @@ int main()
                 window.setView(View(visibleArea));
             }
 
+            if (event.type == Event::MouseWheelScrolled && !mostrandoIntro && !mostrandoSelector)
+            {
+                camera.zoom(event.mouseWheelScroll.delta > 0 ? 1.25f : 0.8f);
+            }
+
             if (event.type == Event::KeyPressed)
             {
                 if (mostrandoIntro)
@@ -125,10 +195,9 @@ int main()
                         selectedMapPath = MAP_PATH;
                         mostrandoSelector = false;
                         
-                        if (loadSelectedMap(selectedMapPath, grid, start, goal, player)) {
+                        if (loadSelectedMap(selectedMapPath, grid, start, goal, player, turnSystem, gameClock)) {
                             std::cout << "=== JUEGO INICIADO CON MAPA POR DEFECTO ===" << std::endl;
-                            animationClock.restart();
-                            backgroundClock.restart();
+                            onMapLoaded();
                         } else {
                             std::cout << "Error critico: No se puede cargar el mapa por defecto" << std::endl;
                             window.close();
@@ -148,17 +217,15 @@ int main()
                         
                         mostrandoSelector = false;
                         
-                        if (loadSelectedMap(selectedMapPath, grid, start, goal, player)) {
+                        if (loadSelectedMap(selectedMapPath, grid, start, goal, player, turnSystem, gameClock)) {
                             std::cout << "=== EXITO: JUEGO INICIADO ===" << std::endl;
-                            animationClock.restart();
-                            backgroundClock.restart();
+                            onMapLoaded();
                         } else {
                             std::cout << "=== ERROR: No se pudo cargar ===" << std::endl;
                             if (selectedMapPath != MAP_PATH) {
-                                if (loadSelectedMap(MAP_PATH, grid, start, goal, player)) {
+                                if (loadSelectedMap(MAP_PATH, grid, start, goal, player, turnSystem, gameClock)) {
                                     std::cout << "=== EXITO CON MAPA POR DEFECTO ===" << std::endl;
-                                    animationClock.restart();
-                                    backgroundClock.restart();
+                                    onMapLoaded();
                                 } else {
                                     window.close();
                                 }
@@ -198,16 +265,14 @@ int main()
                         std::cout << "Ruta del portapapeles: " << selectedMapPath << std::endl;
                         mostrandoSelector = false;
                         
-                        if (loadSelectedMap(selectedMapPath, grid, start, goal, player)) {
+                        if (loadSelectedMap(selectedMapPath, grid, start, goal, player, turnSystem, gameClock)) {
                             std::cout << "=== EXITO: JUEGO INICIADO CON MAPA DEL PORTAPAPELES ===" << std::endl;
-                            animationClock.restart();
-                            backgroundClock.restart();
+                            onMapLoaded();
                         } else {
                             std::cout << "=== ERROR: No se pudo cargar mapa del portapapeles, usando defecto ===" << std::endl;
-                            if (loadSelectedMap(MAP_PATH, grid, start, goal, player)) {
+                            if (loadSelectedMap(MAP_PATH, grid, start, goal, player, turnSystem, gameClock)) {
                                 std::cout << "=== EXITO CON MAPA POR DEFECTO ===" << std::endl;
-                                animationClock.restart();
-                                backgroundClock.restart();
+                                onMapLoaded();
                             } else {
                                 window.close();
                             }
@@ -237,60 +302,25 @@ int main()
                             pathCells.clear();
                             lastPlayerRow = -1;
                             lastPlayerCol = -1;
+                            solver.cancel();
+                            pendingSolve = PendingSolve::None;
                             std::cout << "Modo manual activado. Usa P para mostrar camino, R para auto-resolucion." << std::endl;
                         }
                     }
-                    else if (event.key.code == Keyboard::P && !showVictoryScreen && !autoSolveMode)
+                    else if (event.key.code == Keyboard::P && !showVictoryScreen && !autoSolveMode &&
+                             pendingSolve != PendingSolve::AutoSolve)
                     {
                         std::cout << "=== MODO VISUALIZACION ACTIVADO ===" << std::endl;
-                        PathfindingResult path = findPath(*grid, player->row, player->col, goal->row, goal->col, player->energy);
-                       
-                        if (path.success && !path.path.empty()) {
-                            pathCells.clear();
-                            for (auto *cell : path.path)
-                            {
-                                pathCells.emplace_back(cell->row, cell->col);
-                            }
-                           
-                            showPathVisualization = true;
-                            autoSolveMode = false;
-                            player->isAutoMoving = false;
-                           
-                            lastPlayerRow = player->row;
-                            lastPlayerCol = player->col;
-                           
-                            std::cout << "Camino mostrado con " << pathCells.size() << " pasos. Presiona T para ejecutar." << std::endl;
-                        } else {
-                            pathCells.clear();
-                            showPathVisualization = false;
-                            lastPlayerRow = -1;
-                            lastPlayerCol = -1;
-                            std::cout << "No se encontro camino hacia la meta." << std::endl;
-                        }
+                        requestSolve(solver, *grid, *player, *goal);
+                        pendingSolve = PendingSolve::Preview;
+                        std::cout << "Buscando camino..." << std::endl;
                     }
                     else if (event.key.code == Keyboard::R && !showVictoryScreen)
                     {
                         std::cout << "=== MODO AUTO-RESOLUCION ACTIVADO ===" << std::endl;
-                        PathfindingResult path = findPath(*grid, player->row, player->col, goal->row, goal->col, player->energy);
-                       
-                        if (path.success && !path.path.empty()) {
-                            pathCells.clear();
-                            for (auto *cell : path.path)
-                            {
-                                pathCells.emplace_back(cell->row, cell->col);
-                            }
-                           
-                            autoSolveMode = true;
-                            player->isAutoMoving = true;
-                            showPathVisualization = false; 
-                           
-                            lastPlayerRow = player->row;
-                            lastPlayerCol = player->col;
-                           
-                            std::cout << "Auto-resolucion iniciada con " << pathCells.size() << " pasos. El jugador se movera automaticamente." << std::endl;
-                        } else {
-                            std::cout << "No se encontro camino para auto-resolucion." << std::endl;
-                        }
+                        requestSolve(solver, *grid, *player, *goal);
+                        pendingSolve = PendingSolve::AutoSolve;
+                        std::cout << "Buscando camino..." << std::endl;
                     }
                     else if (event.key.code == Keyboard::T && showPathVisualization && !autoSolveMode && !showVictoryScreen)
                     {
@@ -302,15 +332,53 @@ int main()
                             std::cout << "Ejecutando camino con " << pathCells.size() << " pasos. El camino permanecera visible." << std::endl;
                         }
                     }
+                    else if (event.key.code == Keyboard::F3)
+                    {
+                        showProfiler = !showProfiler;
+                    }
+                    else if (event.key.code == Keyboard::F4)
+                    {
+                        if (profiler.recordingCsv()) {
+                            std::cout << "Perfil guardado en " << profiler.csvPath() << std::endl;
+                            profiler.stopCsv();
+                        } else if (profiler.startCsv(PROFILE_CSV_PATH)) {
+                            std::cout << "Grabando perfil por frame en " << PROFILE_CSV_PATH << std::endl;
+                        } else {
+                            std::cout << "Error: No se pudo crear " << PROFILE_CSV_PATH << std::endl;
+                        }
+                    }
+                    else if (event.key.code == Keyboard::F)
+                    {
+                        camera.setFollow(!camera.following());
+                    }
+                    else if (event.key.code == Keyboard::Home)
+                    {
+                        camera.reset();
+                    }
+                    else if (event.key.code == Keyboard::Add || event.key.code == Keyboard::Equal)
+                    {
+                        camera.zoom(1.25f);
+                    }
+                    else if (event.key.code == Keyboard::Subtract || event.key.code == Keyboard::Hyphen)
+                    {
+                        camera.zoom(0.8f);
+                    }
                     else if (!showVictoryScreen && !autoSolveMode && !player->isAutoMoving)
                     {
                        
                         int oldRow = player->row;
                         int oldCol = player->col;
                        
-                        handlePlayerMovement(event.key.code, *player, *grid);
+                        if (std::optional<core::Action> action = actionFromKey(event.key.code)) {
+                            applyAction(*action, *player, *grid, turnSystem);
+                        }
                        
                         if (player->row != oldRow || player->col != oldCol) {
+                            // Una busqueda pedida desde la celda anterior ya no sirve.
+                            if (pendingSolve != PendingSolve::None) {
+                                solver.cancel();
+                                pendingSolve = PendingSolve::None;
+                            }
                             if (showPathVisualization) {
                                 pathCells.clear();
                                 showPathVisualization = false;
@@ -323,75 +391,164 @@ int main()
             }
         }
 
-        if (!mostrandoIntro && !mostrandoSelector && grid && player && goal)
+        eventsTimer.stop();
+
+        // Resultado de la busqueda en segundo plano, si ya llego.
+        if (pendingSolve != PendingSolve::None && grid && player && goal)
         {
-            if (!autoSolveMode && showPathVisualization) {
-                if (player->row != lastPlayerRow || player->col != lastPlayerCol) {
-                    if (!isPathStillValid(*grid, pathCells, player->row, player->col)) {
-                        pathCells.clear();
+            if (solver.isStale(*grid, player->row, player->col, player->energy))
+            {
+                // Aparecio una pared o una banda movio al jugador: se busca otra vez desde el estado actual.
+                requestSolve(solver, *grid, *player, *goal);
+            }
+            else if (std::optional<PathfindingResult> path = solver.poll())
+            {
+                PendingSolve purpose = pendingSolve;
+                pendingSolve = PendingSolve::None;
+
+                if (purpose == PendingSolve::Replan)
+                {
+                    if (showPathVisualization || autoSolveMode)
+                    {
+                        applyRecalculatedPath(*path, *player, pathCells, showPathVisualization, autoSolveMode);
+                    }
+                }
+                else if (path->success && !path->path.empty())
+                {
+                    pathCells.clear();
+                    for (const auto& cell : path->path)
+                    {
+                        pathCells.emplace_back(cell.row, cell.col);
+                    }
+
+                    lastPlayerRow = player->row;
+                    lastPlayerCol = player->col;
+
+                    if (purpose == PendingSolve::Preview)
+                    {
+                        showPathVisualization = true;
+                        autoSolveMode = false;
+                        player->isAutoMoving = false;
+                        std::cout << "Camino mostrado con " << pathCells.size() << " pasos. Presiona T para ejecutar." << std::endl;
+                    }
+                    else
+                    {
+                        autoSolveMode = true;
+                        player->isAutoMoving = true;
                         showPathVisualization = false;
-                        lastPlayerRow = -1;
-                        lastPlayerCol = -1;
+                        std::cout << "Auto-resolucion iniciada con " << pathCells.size() << " pasos. El jugador se movera automaticamente." << std::endl;
                     }
                 }
+                else if (purpose == PendingSolve::Preview)
+                {
+                    pathCells.clear();
+                    showPathVisualization = false;
+                    lastPlayerRow = -1;
+                    lastPlayerCol = -1;
+                    std::cout << "No se encontro camino hacia la meta." << std::endl;
+                }
+                else
+                {
+                    std::cout << "No se encontro camino para auto-resolucion." << std::endl;
+                }
             }
+        }
 
-            int currentTurnCount = TurnSystem::getCurrentTurnCount();
-            if (currentTurnCount != lastTurnCount) {
-                lastTurnCount = currentTurnCount;
-                pathNeedsUpdate = true;
-            }
+        // Se simulan los ticks que caben en el tiempo real transcurrido; el resto se acumula.
+        double droppedBefore = timestep.droppedSeconds();
+        int ticks = timestep.advance(frameClock.restart().asSeconds());
+        profiler.setTicks(ticks);
+        profiler.setDroppedMs(static_cast<float>((timestep.droppedSeconds() - droppedBefore) * 1000.0));
+        for (int tick = 0; tick < ticks; ++tick)
+        {
+            utils::ScopedTimer tickTimer(utils::FramePhase::Simulation);
+            gameClock.advance(timestep.tickSeconds());
 
-            if (pathNeedsUpdate && !pathCells.empty() && (showPathVisualization || autoSolveMode)) {
-                pathNeedsUpdate = false;
-               
-                if (!isPathStillValid(*grid, pathCells, player->row, player->col)) {
-                    bool wasExecuting = autoSolveMode;
-                   
-                    if (!recalculatePath(*grid, *player, goal, pathCells, showPathVisualization, autoSolveMode)) {
-                        if (wasExecuting) {
-                            autoSolveMode = false;
-                            player->isAutoMoving = false;
+            if (!mostrandoIntro && !mostrandoSelector && grid && player && goal)
+            {
+                player->savePreviousPosition(*grid);
+                player->updateMovement();
+
+                if (!autoSolveMode && showPathVisualization) {
+                    utils::ScopedTimer timer(utils::FramePhase::PathValidation);
+                    if (player->row != lastPlayerRow || player->col != lastPlayerCol) {
+                        if (!isPathStillValid(*grid, pathCells, player->row, player->col)) {
+                            pathCells.clear();
+                            showPathVisualization = false;
+                            lastPlayerRow = -1;
+                            lastPlayerCol = -1;
                         }
                     }
                 }
-            }
 
-            if (autoSolveMode && player->isAutoMoving) {
-                core::updateAutoMovement(*grid, *player, pathCells, goal->row, goal->col);
+                // Paredes nuevas o rotas: solo se miran las celdas que cambiaron desde la ultima revision.
+                if (grid->version() != pathCheckedVersion) {
+                    utils::ScopedTimer timer(utils::FramePhase::PathValidation);
+                    bool blocked = !pathCells.empty() && (showPathVisualization || autoSolveMode) &&
+                        isPathBlockedSince(*grid, pathCells, pathCheckedVersion, player->row, player->col);
+                    pathCheckedVersion = grid->version();
+
+                    if (blocked) {
+                        std::cout << "Recalculando camino en segundo plano..." << std::endl;
+                        requestSolve(solver, *grid, *player, *goal);
+                        pendingSolve = PendingSolve::Replan;
+                    }
+                }
+
+                // Mientras se recalcula el camino el jugador espera en vez de seguir el camino invalido.
+                if (autoSolveMode && player->isAutoMoving && pendingSolve != PendingSolve::Replan) {
+                    utils::ScopedTimer timer(utils::FramePhase::AutoMovement);
+                    core::updateAutoMovement(*grid, *player, turnSystem, pathCells, goal->row, goal->col);
                
-                if (!player->isAutoMoving) {
-                    std::cout << "=== AUTO-MOVIMIENTO COMPLETADO ===" << std::endl;
-                    autoSolveMode = false;
+                    if (!player->isAutoMoving) {
+                        std::cout << "=== AUTO-MOVIMIENTO COMPLETADO ===" << std::endl;
+                        autoSolveMode = false;
                    
-                    if (!showPathVisualization) {
-                        pathCells.clear();
-                        std::cout << "Camino limpiado. Volviendo a modo manual." << std::endl;
-                    } else {
-                        std::cout << "Camino mantenido visible. Presiona ESC para limpiar." << std::endl;
-                    }
+                        if (!showPathVisualization) {
+                            pathCells.clear();
+                            std::cout << "Camino limpiado. Volviendo a modo manual." << std::endl;
+                        } else {
+                            std::cout << "Camino mantenido visible. Presiona ESC para limpiar." << std::endl;
+                        }
                    
-                    lastPlayerRow = player->row;
-                    lastPlayerCol = player->col;
+                        lastPlayerRow = player->row;
+                        lastPlayerCol = player->col;
+                    }
                 }
-            }
 
-            if (!gameWon && player->hasWon)
-            {
-                gameWon = true;
-                showVictoryScreen = true;
-                autoSolveMode = false;
-                showPathVisualization = false;
-                player->isAutoMoving = false;
-                pathCells.clear();
-                lastPlayerRow = -1;
-                lastPlayerCol = -1;
-                victoryClock.restart();
+                if (!gameWon && player->hasWon)
+                {
+                    gameWon = true;
+                    showVictoryScreen = true;
+                    autoSolveMode = false;
+                    showPathVisualization = false;
+                    player->isAutoMoving = false;
+                    pathCells.clear();
+                    lastPlayerRow = -1;
+                    lastPlayerCol = -1;
+                    solver.cancel();
+                    pendingSolve = PendingSolve::None;
+                    victoryClock.restart();
+                }
+
+                if (!showVictoryScreen)
+                {
+                    handleConveyorMovement(*player, *grid);
+                }
             }
 
-            if (!showVictoryScreen)
+            // Las flechas mueven la vista mientras se mantienen pulsadas.
+            if (!mostrandoIntro && !mostrandoSelector && grid && window.hasFocus())
             {
-                handleConveyorMovement(*player, *grid);
+                Vector2f pan;
+                if (Keyboard::isKeyPressed(Keyboard::Left)) pan.x -= CAMERA_PAN_SPEED;
+                if (Keyboard::isKeyPressed(Keyboard::Right)) pan.x += CAMERA_PAN_SPEED;
+                if (Keyboard::isKeyPressed(Keyboard::Up)) pan.y -= CAMERA_PAN_SPEED;
+                if (Keyboard::isKeyPressed(Keyboard::Down)) pan.y += CAMERA_PAN_SPEED;
+                if (pan.x != 0 || pan.y != 0)
+                {
+                    camera.pan(pan);
+                }
             }
         }
 
@@ -408,21 +565,44 @@ int main()
         else if (showVictoryScreen && grid && player)
         {
             drawVictoryScreen(window, font, player->winTime,
-                              TurnSystem::getCurrentTurnCount(), victoryClock);
+                              turnSystem.getCurrentTurnCount(), victoryClock);
         }
         else if (grid && player)
         {
-            drawGrid(window, *grid, *player, hexagon, texto, font, animationClock, backgroundClock, pathCells);
+#ifdef HEXESCAPE_SINGLE_THREAD
+            // Mientras se busca el primer camino se muestra el mejor tramo encontrado hasta ahora.
+            const std::vector<std::pair<int, int>>& shownPath =
+                pendingSolve != PendingSolve::None && pathCells.empty() ? solver.partialPath() : pathCells;
+#else
+            const std::vector<std::pair<int, int>>& shownPath = pathCells;
+#endif
+            drawGrid(window, *grid, *player, boardRenderer, camera, font, animationClock, backgroundClock, shownPath,
+                     timestep.alpha());
 
             drawModernEnergyBar(window, *player, font, animationClock);
-            drawGameInfo(window, font, TurnSystem::getCurrentTurnCount(), animationClock,
-                        showPathVisualization, autoSolveMode);
+            drawGameInfo(window, font, turnSystem.getCurrentTurnCount(), animationClock,
+                        showPathVisualization, autoSolveMode, pendingSolve != PendingSolve::None);
             drawModernControls(window, font, animationClock);
+            if (showProfiler)
+            {
+                drawProfilerOverlay(window, font, profiler, timestep.tickRate(), timestep.droppedSeconds());
+            }
+        }
+
+        {
+            // Incluye la espera del limite de frames.
+            utils::ScopedTimer timer(utils::FramePhase::Display);
+            window.display();
         }
 
-        window.display();
+        if (profiling)
+        {
+            profiler.endFrame();
+        }
     }
 
+    utils::Profiler::setCurrent(nullptr);
+
     if (grid) {
         delete grid;
         grid = nullptr;
@@ -0,0 +1,111 @@
+#include "ConveyorTable.hpp"
+#include "HexGrid.hpp"
+#include "Player.hpp"
+#include <algorithm>
+
+
+using namespace model;
+
+int ConveyorTable::next(const HexGrid &grid, int index) const
+{
+    int row = index / grid.cols();
+    int col = index % grid.cols();
+    CellType type = grid.types()[index];
+
+    if (!isConveyor(type) || isCyclic(index))
+        return -1;
+
+    auto offset = conveyorOffset(type, row % 2 != 0);
+    int nr = row + offset.first;
+    int nc = col + offset.second;
+
+    if (!grid.inBounds(nr, nc) || grid.type(nr, nc) == CellType::WALL)
+        return -1;
+
+    return grid.index(nr, nc);
+}
+
+void ConveyorTable::build(const HexGrid &grid)
+{
+    enum : std::uint8_t { PENDING, ON_STACK, DONE };
+
+    const int cellCount = grid.rows() * grid.cols();
+    const int maxGain = Player::MAX_ENERGY;
+    const std::vector<CellType> &types = grid.types();
+    m_target.resize(cellCount);
+    m_info.assign(cellCount, 0);
+    m_maxSlide = 0;
+
+    std::vector<std::uint8_t> state(cellCount, PENDING);
+    std::vector<int> steps(cellCount, 0);
+    std::vector<int> stack;
+
+    for (int start = 0; start < cellCount; ++start)
+    {
+        if (state[start] == DONE)
+            continue;
+
+        // Seguir la cadena de bandas hasta una celda ya resuelta, un final o un ciclo.
+        int current = start;
+        while (true)
+        {
+            if (state[current] == DONE)
+                break;
+
+            if (state[current] == ON_STACK)
+            {
+                // Todo lo que esta en la pila por encima de `current` es el ciclo.
+                int member;
+                do
+                {
+                    member = stack.back();
+                    stack.pop_back();
+                    m_target[member] = member;
+                    m_info[member] = CYCLIC_BIT;
+                    steps[member] = 0;
+                    state[member] = DONE;
+                } while (member != current);
+                break;
+            }
+
+            int row = current / grid.cols();
+            int col = current % grid.cols();
+            CellType type = types[current];
+            int following = -1;
+
+            if (isConveyor(type))
+            {
+                auto offset = conveyorOffset(type, row % 2 != 0);
+                int nr = row + offset.first;
+                int nc = col + offset.second;
+                if (grid.inBounds(nr, nc) && types[grid.index(nr, nc)] != CellType::WALL)
+                    following = grid.index(nr, nc);
+            }
+
+            if (following < 0)
+            {
+                m_target[current] = current;
+                state[current] = DONE;
+                break;
+            }
+
+            state[current] = ON_STACK;
+            stack.push_back(current);
+            current = following;
+        }
+
+        // Deshacer la pila: cada celda hereda el destino de la siguiente.
+        while (!stack.empty())
+        {
+            int cell = stack.back();
+            stack.pop_back();
+
+            int following = next(grid, cell);
+            m_target[cell] = m_target[following];
+            steps[cell] = steps[following] + 1;
+            m_info[cell] = static_cast<std::uint8_t>(std::min(steps[cell], maxGain));
+            m_maxSlide = std::max(m_maxSlide, steps[cell]);
+            state[cell] = DONE;
+        }
+    }
+}
@@ -0,0 +1,57 @@
+#pragma once
+
+
+#include <cstdint>
+#include <vector>
+#include "HexCell.hpp"
+
+
+namespace model
+{
+    class HexGrid;
+
+
+    // Resultado de subirse a una celda: donde termina el jugador y cuanta energia gana.
+    struct ConveyorJump
+    {
+        int target;
+        int gain;
+        bool cyclic;
+    };
+
+
+    // Tabla de resolucion de bandas transportadoras. Se construye una vez por
+    // version del grid y resuelve cualquier deslizamiento en O(1).
+    //
+    // Las celdas que forman un ciclo de bandas quedan marcadas como ciclicas y
+    // se comportan como suelo normal: no mueven al jugador, asi ningun
+    // deslizamiento puede quedar girando para siempre.
+    class ConveyorTable
+    {
+    public:
+        void build(const HexGrid &grid);
+
+        ConveyorJump jump(int index) const
+        {
+            std::uint8_t info = m_info[index];
+            return ConveyorJump{ m_target[index], info & GAIN_MASK, (info & CYCLIC_BIT) != 0 };
+        }
+
+        int target(int index) const { return m_target[index]; }
+        bool isCyclic(int index) const { return (m_info[index] & CYCLIC_BIT) != 0; }
+
+        // Siguiente celda de la banda en un solo paso, o -1 si la banda no mueve.
+        int next(const HexGrid &grid, int index) const;
+
+        // Mayor numero de celdas que recorre un deslizamiento en este grid.
+        int maxSlide() const { return m_maxSlide; }
+
+    private:
+        static constexpr std::uint8_t GAIN_MASK = 0x7F;
+        static constexpr std::uint8_t CYCLIC_BIT = 0x80;
+
+        std::vector<int> m_target;
+        std::vector<std::uint8_t> m_info;
+        int m_maxSlide = 0;
+    };
+}
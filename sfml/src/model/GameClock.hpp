@@ -0,0 +1,57 @@
+#pragma once
+
+#include <chrono>
+
+
+namespace model
+{
+    /**
+     * @brief Fuente de tiempo de la partida, en segundos.
+     *
+     * Las reglas y el jugador leen el tiempo solo a traves de esta interfaz,
+     * asi una simulacion sin ventana puede usar un reloj manual y avanzar
+     * tan rapido como quiera.
+     */
+    class GameClock
+    {
+    public:
+        virtual ~GameClock() = default;
+        virtual double seconds() const = 0;
+    };
+
+
+    // Tiempo real (monotonico) desde que se creo el reloj.
+    class SystemClock : public GameClock
+    {
+    public:
+        double seconds() const override
+        {
+            return std::chrono::duration<double>(std::chrono::steady_clock::now() - m_start).count();
+        }
+
+    private:
+        std::chrono::steady_clock::time_point m_start = std::chrono::steady_clock::now();
+    };
+
+
+    // Tiempo virtual que solo avanza cuando se pide.
+    class ManualClock : public GameClock
+    {
+    public:
+        double seconds() const override { return m_now; }
+
+        void advance(double dt) { m_now += dt; }
+        void set(double now) { m_now = now; }
+
+    private:
+        double m_now = 0.0;
+    };
+
+
+    // Reloj de tiempo real compartido, usado por defecto por el juego con ventana.
+    inline const GameClock &systemClock()
+    {
+        static const SystemClock clock;
+        return clock;
+    }
+}
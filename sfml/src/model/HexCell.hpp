@@ -1,9 +1,13 @@
 #pragma once
 
+#include <cstdint>
+#include <utility>
+
 
 namespace model
 {
-    enum class CellType
+    // Un byte por celda: el grid guarda solo este valor en un buffer contiguo.
+    enum class CellType : std::uint8_t
     {
         EMPTY,
         WALL,
@@ -20,14 +24,48 @@ namespace model
     };
 
 
-    struct HexCell
+    inline bool isConveyor(CellType type)
     {
-        int row, col;
-        CellType type;
+        return type >= CellType::UP_RIGHT && type <= CellType::DOWN_LEFT;
+    }
+
+    // Desplazamiento (fila, columna) que aplica una banda transportadora.
+    inline std::pair<int, int> conveyorOffset(CellType type, bool isOddRow)
+    {
+        switch (type)
+        {
+        case CellType::UP_RIGHT: // A - Arriba-Derecha
+            return {-1, isOddRow ? 1 : 0};
+        case CellType::RIGHT: // B - Derecha
+            return {0, 1};
+        case CellType::DOWN_RIGHT: // C - Abajo-Derecha
+            return {1, isOddRow ? 1 : 0};
+        case CellType::DOWN_LEFT: // D - Abajo-Izquierda
+            return {1, isOddRow ? 0 : -1};
+        case CellType::LEFT: // E - Izquierda
+            return {0, -1};
+        case CellType::UP_LEFT: // F - Arriba-Izquierda
+            return {-1, isOddRow ? 0 : -1};
+        default:
+            return {0, 0}; // No movimiento automático
+        }
+    }
+
 
-        bool hasPlayer = false;
+    // Vecinos en layout "odd-r": la columna depende de la paridad de la fila.
+    inline constexpr int NEIGHBOR_ROW[6] = { 0, 1, 1, 0, -1, -1 };
+    inline constexpr int NEIGHBOR_COL_EVEN[6] = { 1, 0, -1, -1, -1, 0 };
+    inline constexpr int NEIGHBOR_COL_ODD[6] = { 1, 1, 0, -1, 0, 1 };
+
+
+    // Vista por valor de una celda; el grid no guarda HexCell, los arma al pedirlos.
+    struct HexCell
+    {
+        int row = 0, col = 0;
+        CellType type = CellType::EMPTY;
 
 
+        HexCell() = default;
         HexCell(int r, int c, CellType t) 
             : row(r), col(c), type(t) {}
     };
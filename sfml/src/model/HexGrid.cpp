@@ -1,64 +1,114 @@
 #include "HexGrid.hpp"
+#include <atomic>
 #include <cassert>    
 
 
 using namespace model;
 
-HexGrid::HexGrid(int rows, int cols)
-    : m_rows(rows), m_cols(cols), m_cells(rows, std::vector<HexCell>()) 
+namespace
 {
-    
-    for (int r = 0; r < m_rows; ++r)
+    // Espacio de versiones de cada grid: ningun grid llega a 2^32 cambios.
+    constexpr unsigned long long VERSION_RANGE = 1ULL << 32;
+
+    unsigned long long nextFirstVersion()
     {
-        m_cells[r].reserve(m_cols);
-    
-        for (int c = 0; c < m_cols; ++c)
-        {
-            
-            m_cells[r].emplace_back(r, c, CellType::EMPTY);
-        }
+        static std::atomic<unsigned long long> next{ 0 };
+        return next.fetch_add(VERSION_RANGE, std::memory_order_relaxed);
     }
-}
 
+    // Clave Zobrist de una celda con un tipo. En lugar de una tabla de numeros
+    // al azar (celdas x tipos) se mezcla el par con splitmix64. EMPTY vale 0,
+    // asi un grid recien creado tiene hash 0 sin recorrerlo.
+    std::uint64_t zobristKey(int cell, CellType type)
+    {
+        if (type == CellType::EMPTY)
+            return 0;
 
-const HexCell &HexGrid::at(int row, int col) const
+        std::uint64_t z = (static_cast<std::uint64_t>(cell) << 8 | static_cast<std::uint64_t>(type)) + 0x9E3779B97F4A7C15ULL;
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        return z ^ (z >> 31);
+    }
+}
+
+HexGrid::HexGrid(int rows, int cols)
+    : m_rows(rows), m_cols(cols), m_types(static_cast<std::size_t>(rows) * cols, CellType::EMPTY),
+      m_firstVersion(nextFirstVersion()), m_version(m_firstVersion)
 {
-    assert(row >= 0 && row < m_rows && col >= 0 && col < m_cols);
-    return m_cells[row][col]; 
 }
 
-HexCell &HexGrid::at(int row, int col)
+HexGrid::HexGrid(const HexGrid &other)
+    : m_rows(other.m_rows), m_cols(other.m_cols), m_types(other.m_types),
+      m_firstVersion(nextFirstVersion()), m_version(m_firstVersion), m_hash(other.m_hash),
+      m_conveyors(other.m_conveyors),
+      m_conveyorsVersion(other.m_conveyorsVersion == other.m_version ? m_version : ~0ULL)
 {
-    assert(row >= 0 && row < m_rows && col >= 0 && col < m_cols);
-    return m_cells[row][col]; 
 }
 
-std::vector<HexCell*> HexGrid::neighbors(const HexCell& cell)
+HexGrid &HexGrid::operator=(const HexGrid &other)
 {
-    static const int dRow[6] = { 0, 1, 1, 0, -1, -1 };
+    if (this == &other)
+        return *this;
+
+    m_rows = other.m_rows;
+    m_cols = other.m_cols;
+    m_types = other.m_types;
+    m_firstVersion = nextFirstVersion();
+    m_version = m_firstVersion;
+    m_hash = other.m_hash;
+    m_journal.clear();
+    m_conveyors = other.m_conveyors;
+    m_conveyorsVersion = other.m_conveyorsVersion == other.m_version ? m_version : ~0ULL;
+    return *this;
+}
 
 
-    static const int dColEven[6] = { 1, 0, -1, -1, -1, 0 }; 
-    static const int dColOdd[6] = { 1, 1, 0, -1, 0, 1 };   
+void HexGrid::setType(int row, int col, CellType type)
+{
+    assert(inBounds(row, col));
+    CellType &current = m_types[index(row, col)];
+    if (current == type)
+        return;
+
+    if (m_journal.empty())
+        m_journal.resize(JOURNAL_SIZE);
+    m_journal[m_version % JOURNAL_SIZE] = CellChange{ index(row, col), current, type };
+    m_hash ^= zobristKey(index(row, col), current) ^ zobristKey(index(row, col), type);
+
+    current = type;
+    ++m_version;
+}
 
+const ConveyorTable &HexGrid::conveyors() const
+{
+    if (m_conveyorsVersion != m_version)
+    {
+        m_conveyors.build(*this);
+        m_conveyorsVersion = m_version;
+    }
+    return m_conveyors;
+}
 
-    std::vector<HexCell*> result;
+HexNeighbors HexGrid::neighbors(const HexCell& cell) const
+{
+    HexNeighbors result;
     int r = cell.row, c = cell.col;
-    bool odd = r % 2 != 0;
+    const int *dCol = (r & 1) ? NEIGHBOR_COL_ODD : NEIGHBOR_COL_EVEN;
 
 
     for (int i = 0; i < 6; ++i) {
-        int nr = r + dRow[i];
-        int nc = c + (odd ? dColOdd[i] : dColEven[i]);
+        int nr = r + NEIGHBOR_ROW[i];
+        int nc = c + dCol[i];
 
 
-        if (nr >= 0 && nr < m_rows && nc >= 0 && nc < m_cols) {
-            result.push_back(&m_cells[nr][nc]);
+        if (inBounds(nr, nc)) {
+            result.push(HexCell(nr, nc, m_types[index(nr, nc)]));
         }
     }
     return result;
 }
-sf::Vector2f HexGrid::toPixel(int row, int col) const
+
+Vec2f HexGrid::toPixel(int row, int col) const
 {
     const float baseX = (row % 2 == 0) ? 50.f : 75.f;
     const float x = baseX + col * 50.f; 
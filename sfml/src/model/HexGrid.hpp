@@ -1,29 +1,127 @@
 #pragma once
 
 
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
 #include <vector>
-#include <SFML/System.hpp>
 #include "HexCell.hpp"
+#include "Vec2.hpp"
+#include "ConveyorTable.hpp"
 
 
 namespace model
 {
 
 
+   // Hasta 6 vecinos guardados en linea: recorrerlos no reserva memoria.
+   class HexNeighbors
+   {
+   public:
+       void push(const HexCell &cell) { m_cells[m_count++] = cell; }
+
+       const HexCell *begin() const { return m_cells.data(); }
+       const HexCell *end() const { return m_cells.data() + m_count; }
+       std::size_t size() const { return m_count; }
+       bool empty() const { return m_count == 0; }
+       const HexCell &operator[](std::size_t i) const { return m_cells[i]; }
+
+   private:
+       std::array<HexCell, 6> m_cells;
+       std::size_t m_count = 0;
+   };
+
+
+   // Un cambio de tipo registrado en el diario del grid.
+   struct CellChange
+   {
+       int cell;
+       CellType oldType;
+       CellType newType;
+   };
+
+
    class HexGrid
    {
    public:
+       // Cambios que guarda el diario; quien se atrase mas tiene que releer el grid entero.
+       static constexpr std::size_t JOURNAL_SIZE = 1024;
+
        HexGrid(int rows, int cols);
 
+       // Una copia es otro grid: recibe su propio rango de versiones y un diario
+       // vacio, para que ediciones distintas en dos copias nunca den la misma version.
+       HexGrid(const HexGrid &other);
+       HexGrid &operator=(const HexGrid &other);
+       HexGrid(HexGrid &&) = default;
+       HexGrid &operator=(HexGrid &&) = default;
 
-       const HexCell &at(int row, int col) const;
-       HexCell &at(int row, int col);
 
+       // Devuelve una vista de la celda; para cambiar el tipo se usa setType.
+       HexCell at(int row, int col) const { return HexCell(row, col, type(row, col)); }
+       CellType type(int row, int col) const {
+           assert(inBounds(row, col));
+           return m_types[index(row, col)];
+       }
 
-       std::vector<HexCell *> neighbors(const HexCell &cell);
+       // Toda modificacion del tipo de una celda pasa por aqui para avanzar la version.
+       void setType(int row, int col, CellType type);
 
+       // Cada grid nuevo, y cada copia, arranca en su propio rango de versiones,
+       // asi que una version vieja de otro grid nunca coincide.
+       unsigned long long version() const { return m_version; }
 
-       sf::Vector2f toPixel(int row, int col) const;
+       // Hash Zobrist de los tipos de celda, al dia tras cada setType: dos grids
+       // del mismo tamano con el mismo contenido tienen el mismo hash.
+       std::uint64_t hash() const { return m_hash; }
+
+       // Llama a visit(CellChange) por cada cambio posterior a la version `since`,
+       // del mas viejo al mas nuevo. Devuelve false sin visitar nada si `since` no
+       // es de este grid o el diario ya no llega tan atras.
+       template <typename Visitor>
+       bool forEachChangeSince(unsigned long long since, Visitor &&visit) const
+       {
+           if (since < m_firstVersion || since > m_version || m_version - since > JOURNAL_SIZE)
+               return false;
+
+           for (unsigned long long v = since; v < m_version; ++v)
+               visit(m_journal[v % JOURNAL_SIZE]);
+           return true;
+       }
+
+       int index(int row, int col) const { return row * m_cols + col; }
+       int rowOf(int index) const { return index / m_cols; }
+       int colOf(int index) const { return index % m_cols; }
+
+       // Buffer plano de tipos, fila por fila, para recorridos completos del grid.
+       const std::vector<CellType> &types() const { return m_types; }
+
+       // Tabla de bandas de la version actual; se reconstruye solo si el grid cambio.
+       const ConveyorTable &conveyors() const;
+
+
+       HexNeighbors neighbors(const HexCell &cell) const;
+
+       // Llama a visit(indice) por cada vecino dentro del grid; pensado para los
+       // bucles de busqueda que trabajan con indices planos.
+       template <typename Visitor>
+       void forEachNeighbor(int cell, Visitor &&visit) const
+       {
+           int r = rowOf(cell), c = colOf(cell);
+           const int *dCol = (r & 1) ? NEIGHBOR_COL_ODD : NEIGHBOR_COL_EVEN;
+
+           for (int i = 0; i < 6; ++i)
+           {
+               int nr = r + NEIGHBOR_ROW[i];
+               int nc = c + dCol[i];
+               if (inBounds(nr, nc))
+                   visit(index(nr, nc));
+           }
+       }
+
+
+       Vec2f toPixel(int row, int col) const;
 
 
        int rows() const { return m_rows; }
@@ -37,7 +135,16 @@ namespace model
    private:
        int m_rows;
        int m_cols;
-       std::vector<std::vector<HexCell>> m_cells;
+       std::vector<CellType> m_types;
+       unsigned long long m_firstVersion;
+       unsigned long long m_version;
+       std::uint64_t m_hash = 0;
+
+       // Anillo de los ultimos JOURNAL_SIZE cambios; el que llevo a la version v+1 esta en v % JOURNAL_SIZE.
+       std::vector<CellChange> m_journal;
+
+       mutable ConveyorTable m_conveyors;
+       mutable unsigned long long m_conveyorsVersion = ~0ULL;
    };
 
 
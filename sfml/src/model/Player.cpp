@@ -1,10 +1,12 @@
 #include "Player.hpp"
 #include "HexGrid.hpp"
+#include <algorithm>
 #include <cmath>
 
 namespace model
 {
-    Player::Player(int r, int c) : row(r), col(c)
+    Player::Player(int r, int c, const GameClock &clock)
+        : row(r), col(c), m_clock(&clock), m_startTime(clock.seconds())
     {
         energy = 0;
         canBreakWall = false;
@@ -52,13 +54,19 @@ namespace model
         return canBreakWall;
     }
 
-    void Player::startMovement(sf::Vector2f start, sf::Vector2f target)
+    void Player::win()
+    {
+        hasWon = true;
+        winTime = static_cast<float>(m_clock->seconds() - m_startTime);
+    }
+
+    void Player::startMovement(Vec2f start, Vec2f target)
     {
-        isMoving = true;
         startPosition = start;
         targetPosition = target;
-        currentPosition = start;
-        movementClock.restart();
+        currentPosition = movementDuration > 0.0f ? start : target;
+        isMoving = movementDuration > 0.0f;
+        m_movementStart = m_clock->seconds();
     }
 
     void Player::updateMovement()
@@ -66,7 +74,7 @@ namespace model
         if (!isMoving)
             return;
 
-        float elapsed = movementClock.getElapsedTime().asSeconds();
+        float elapsed = static_cast<float>(m_clock->seconds() - m_movementStart);
         float progress = elapsed / movementDuration;
 
         if (progress >= 1.0f)
@@ -82,7 +90,7 @@ namespace model
         }
     }
 
-    sf::Vector2f Player::getVisualPosition(const HexGrid& grid) const
+    Vec2f Player::getVisualPosition(const HexGrid& grid) const
     {
         if (isMoving)
         {
@@ -93,4 +101,23 @@ namespace model
             return grid.toPixel(row, col);
         }
     }
+
+    void Player::savePreviousPosition(const HexGrid& grid)
+    {
+        m_previousPosition = getVisualPosition(grid);
+        m_hasPreviousPosition = true;
+    }
+
+    Vec2f Player::getInterpolatedPosition(const HexGrid& grid, float alpha) const
+    {
+        Vec2f current = getVisualPosition(grid);
+        if (!m_hasPreviousPosition)
+        {
+            return current;
+        }
+
+        alpha = std::max(0.0f, std::min(alpha, 1.0f));
+        return {m_previousPosition.x + (current.x - m_previousPosition.x) * alpha,
+                m_previousPosition.y + (current.y - m_previousPosition.y) * alpha};
+    }
 }
\ No newline at end of file
@@ -1,6 +1,7 @@
 #pragma once
 #include "HexCell.hpp"
-#include <SFML/System.hpp>
+#include "GameClock.hpp"
+#include "Vec2.hpp"
 
 namespace model
 {
@@ -19,20 +20,19 @@ namespace model
 
         bool hasWon = false;
         float winTime = 0.0f;
-        sf::Clock winClock;
 
         model::CellType lastCellType = model::CellType::EMPTY;
 
         bool isAutoMoving = false;
 
         bool isMoving = false;
-        sf::Vector2f startPosition;
-        sf::Vector2f targetPosition;
-        sf::Vector2f currentPosition;
-        sf::Clock movementClock;
+        Vec2f startPosition;
+        Vec2f targetPosition;
+        Vec2f currentPosition;
+        // 0 desactiva la animacion: el movimiento es instantaneo (simulacion sin ventana).
         float movementDuration = 0.3f;
 
-        Player(int r, int c);
+        Player(int r, int c, const GameClock &clock = systemClock());
 
         void gainEnergy();
         void resetEnergy();
@@ -42,8 +42,23 @@ namespace model
         void useWallBreak();
         bool canUseWallBreak() const;
 
-        void startMovement(sf::Vector2f start, sf::Vector2f target);
+        // Marca la victoria y guarda el tiempo desde que empezo la partida.
+        void win();
+
+        void startMovement(Vec2f start, Vec2f target);
         void updateMovement();
-        sf::Vector2f getVisualPosition(const class HexGrid& grid) const;
+        Vec2f getVisualPosition(const class HexGrid& grid) const;
+
+        // Guarda la posicion visual antes de un tick de simulacion; al dibujar se
+        // interpola entre ella y la actual con la fraccion de tick transcurrida.
+        void savePreviousPosition(const class HexGrid& grid);
+        Vec2f getInterpolatedPosition(const class HexGrid& grid, float alpha) const;
+
+    private:
+        const GameClock *m_clock;
+        double m_startTime;
+        double m_movementStart = 0.0;
+        Vec2f m_previousPosition;
+        bool m_hasPreviousPosition = false;
     };
 }
\ No newline at end of file
@@ -0,0 +1,12 @@
+#pragma once
+
+
+namespace model
+{
+    // Posicion en pixeles del modelo; el front end la convierte a sf::Vector2f.
+    struct Vec2f
+    {
+        float x = 0.f;
+        float y = 0.f;
+    };
+}
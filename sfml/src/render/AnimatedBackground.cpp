@@ -0,0 +1,84 @@
+#include "AnimatedBackground.hpp"
+#include "DrawCalls.hpp"
+#include "EffectsRenderer.hpp"
+#include "GridMesh.hpp"
+#include <cmath>
+
+using namespace sf;
+
+namespace {
+
+constexpr int BAND_VERTICES = 6;
+
+}
+
+AnimatedBackground::AnimatedBackground(const BackgroundStyle& style)
+    : m_style(style)
+{
+}
+
+void AnimatedBackground::rebuild(Vector2u size)
+{
+    m_size = size;
+
+    int bands = (static_cast<int>(size.y) + m_style.bandHeight - 1) / m_style.bandHeight;
+    m_bands.resize(static_cast<std::size_t>(bands) * BAND_VERTICES);
+
+    float width = static_cast<float>(size.x);
+    for (int b = 0; b < bands; ++b) {
+        float top = static_cast<float>(b * m_style.bandHeight);
+        float bottom = top + m_style.bandHeight;
+
+        std::size_t v = static_cast<std::size_t>(b) * BAND_VERTICES;
+        m_bands[v].position = Vector2f(0, top);
+        m_bands[v + 1].position = Vector2f(width, top);
+        m_bands[v + 2].position = Vector2f(width, bottom);
+        m_bands[v + 3].position = Vector2f(0, top);
+        m_bands[v + 4].position = Vector2f(width, bottom);
+        m_bands[v + 5].position = Vector2f(0, bottom);
+    }
+}
+
+void AnimatedBackground::update(Vector2u size, float time)
+{
+    if (size != m_size) {
+        rebuild(size);
+    }
+
+    std::size_t bands = m_bands.getVertexCount() / BAND_VERTICES;
+    for (std::size_t b = 0; b < bands; ++b) {
+        float gradient = static_cast<float>(b * m_style.bandHeight) / size.y;
+        float wave = std::sin(time * m_style.waveSpeed + gradient * 8.0f) * m_style.waveDepth
+                   + (1.0f - m_style.waveDepth);
+
+        Color color = gradient < 0.5f
+            ? lerpColor(m_style.top, m_style.mid, gradient * 2.0f * wave)
+            : lerpColor(m_style.mid, m_style.bottom, (gradient - 0.5f) * 2.0f * wave);
+
+        for (std::size_t v = b * BAND_VERTICES; v < (b + 1) * BAND_VERTICES; ++v) {
+            m_bands[v].color = color;
+        }
+    }
+}
+
+void AnimatedBackground::draw(RenderTarget& target) const
+{
+    drawCounted(target, m_bands);
+}
+
+void DecorativeHexBatch::clear()
+{
+    m_vertices.clear();
+}
+
+void DecorativeHexBatch::add(Vector2f position, float size, float thickness, Color color, float degrees)
+{
+    std::size_t first = m_vertices.getVertexCount();
+    m_vertices.resize(first + GridMesh::OUTLINE_VERTICES);
+    writeHexRing(m_vertices, first, position, size, thickness, color, degrees);
+}
+
+void DecorativeHexBatch::draw(RenderTarget& target) const
+{
+    drawCounted(target, m_vertices);
+}
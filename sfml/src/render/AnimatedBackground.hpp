@@ -0,0 +1,55 @@
+#ifndef ANIMATED_BACKGROUND_HPP
+#define ANIMATED_BACKGROUND_HPP
+
+#include <SFML/Graphics.hpp>
+
+// Degradado de tres colores que ondula con el tiempo.
+struct BackgroundStyle
+{
+    sf::Color top;
+    sf::Color mid;
+    sf::Color bottom;
+    float waveSpeed;   // velocidad de la onda
+    float waveDepth;   // cuanto recorta la onda el degradado (0 = fijo)
+    int bandHeight;    // alto de cada banda en pixeles
+};
+
+/**
+ * @brief Fondo degradado en un solo VertexArray.
+ *
+ * Cada banda es un rectangulo de color plano, igual que las lineas que antes
+ * se dibujaban una a una. La geometria solo cambia con el tamano del target;
+ * cada frame solo se reescriben los colores.
+ */
+class AnimatedBackground
+{
+public:
+    explicit AnimatedBackground(const BackgroundStyle& style);
+
+    void update(sf::Vector2u size, float time);
+    void draw(sf::RenderTarget& target) const;
+
+private:
+    void rebuild(sf::Vector2u size);
+
+    BackgroundStyle m_style;
+    sf::Vector2u m_size;
+    sf::VertexArray m_bands{ sf::Triangles };
+};
+
+// Bordes de hexagonos decorativos acumulados para dibujarse en una llamada.
+class DecorativeHexBatch
+{
+public:
+    void clear();
+
+    // Mismo hexagono que CircleShape(size, 6) con setOutlineThickness(thickness) y rotate(degrees).
+    void add(sf::Vector2f position, float size, float thickness, sf::Color color, float degrees);
+
+    void draw(sf::RenderTarget& target) const;
+
+private:
+    sf::VertexArray m_vertices{ sf::Triangles };
+};
+
+#endif
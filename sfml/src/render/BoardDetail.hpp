@@ -0,0 +1,35 @@
+#ifndef BOARD_DETAIL_HPP
+#define BOARD_DETAIL_HPP
+
+// Nivel de detalle del tablero segun el tamano de los hexagonos en pantalla.
+enum class BoardDetail
+{
+    Texels,  // una textura con un texel por celda
+    Fills,   // solo rellenos planos y el camino
+    Full     // sombras, bordes, etiquetas, efectos y numeros de paso
+};
+
+// Por debajo de este tamano un hexagono ocupa unos pocos pixeles.
+constexpr float TEXEL_DETAIL_BELOW = 4.0f;
+
+// Desde aqui se ven bordes y etiquetas; sombras y numeros tienen ademas su propio minimo.
+constexpr float FULL_DETAIL_FROM = 8.0f;
+
+inline BoardDetail detailForHexSize(float hexSize)
+{
+    if (hexSize < TEXEL_DETAIL_BELOW) {
+        return BoardDetail::Texels;
+    }
+    return hexSize < FULL_DETAIL_FROM ? BoardDetail::Fills : BoardDetail::Full;
+}
+
+inline const char* detailName(BoardDetail detail)
+{
+    switch (detail) {
+        case BoardDetail::Texels: return "texeles";
+        case BoardDetail::Fills: return "rellenos";
+        default: return "completo";
+    }
+}
+
+#endif
@@ -0,0 +1,341 @@
+#include "BoardRenderer.hpp"
+#include "DrawCalls.hpp"
+#include "EffectsRenderer.hpp"
+#include <algorithm>
+#include <cmath>
+#include <string>
+
+using namespace model;
+using namespace sf;
+
+namespace {
+
+const Color PATH_OUTLINE(255, 0, 0);
+const Color PATH_FILL(255, 100, 100, 150);
+const Color NUMBER_BACKGROUND(0, 0, 0, 180);
+
+// Pixeles de mas que se arman alrededor de lo visible.
+constexpr float REGION_MARGIN = 256.0f;
+
+// Mismo numero de lados que un CircleShape por defecto.
+constexpr int CIRCLE_POINTS = 30;
+
+// Circulo relleno con borde de 1 px por fuera, como CircleShape con setOutlineThickness(1).
+void appendCircle(VertexArray& batch, Vector2f center, float radius, Color fill, Color outline)
+{
+    const float step = 2 * 3.14159265f / CIRCLE_POINTS;
+    const float outer = radius + 1.0f / std::cos(step / 2);
+
+    Vector2f points[CIRCLE_POINTS];
+    for (int i = 0; i < CIRCLE_POINTS; ++i) {
+        float angle = i * step - 3.14159265f / 2;
+        points[i] = Vector2f(std::cos(angle), std::sin(angle));
+    }
+
+    for (int i = 0; i < CIRCLE_POINTS; ++i) {
+        const Vector2f& a = points[i];
+        const Vector2f& b = points[(i + 1) % CIRCLE_POINTS];
+        batch.append(Vertex(center, fill));
+        batch.append(Vertex(center + a * radius, fill));
+        batch.append(Vertex(center + b * radius, fill));
+    }
+    for (int i = 0; i < CIRCLE_POINTS; ++i) {
+        const Vector2f& a = points[i];
+        const Vector2f& b = points[(i + 1) % CIRCLE_POINTS];
+        Vertex innerA(center + a * radius, outline), outerA(center + a * outer, outline);
+        Vertex innerB(center + b * radius, outline), outerB(center + b * outer, outline);
+        batch.append(innerA);
+        batch.append(outerA);
+        batch.append(outerB);
+        batch.append(innerA);
+        batch.append(outerB);
+        batch.append(innerB);
+    }
+}
+
+}
+
+void BoardRenderer::update(const HexGrid& grid, const HexLayout& layout, Vector2u targetSize,
+                           const std::vector<std::pair<int, int>>& pathCells, const Font& font)
+{
+    bool gridChanged = m_grid != &grid || m_rows != grid.rows() || m_cols != grid.cols();
+    bool pathChanged = false;
+
+    if (gridChanged) {
+        m_grid = &grid;
+        m_rows = grid.rows();
+        m_cols = grid.cols();
+        resetGrid(grid, pathCells);
+    } else {
+        if (m_path != pathCells) {
+            updatePath(grid, pathCells);
+            pathChanged = true;
+        }
+        if (m_version != grid.version()) {
+            collectChangedCells(grid);
+        }
+    }
+
+    BoardDetail detail = detailForHexSize(layout.hexSize);
+    if (detail == BoardDetail::Texels && !BoardTexels::fits(grid)) {
+        detail = BoardDetail::Fills;
+    }
+
+    CellRange visible = visibleCells(layout, targetSize, m_rows, m_cols, layout.hexSize);
+    if (gridChanged || detail != m_detail || layout.hexSize != m_layout.hexSize || m_size != targetSize ||
+        !m_region.contains(visible)) {
+        m_detail = detail;
+        m_layout = layout;
+        m_size = targetSize;
+        rebuildRegion(grid, visible, font);
+    } else {
+        if (pathChanged) {
+            rebuildPathOverlay(font);
+        }
+        if (m_detail == BoardDetail::Texels) {
+            m_texels.flush(grid, m_pathMask);
+        } else if (m_detail == BoardDetail::Full) {
+            m_layer.redrawDirty(grid, m_pathMask, font);
+        }
+    }
+
+    m_states.transform = Transform();
+    m_states.transform.translate(layout.offsetX - m_layout.offsetX, layout.offsetY - m_layout.offsetY);
+}
+
+void BoardRenderer::resetGrid(const HexGrid& grid, const std::vector<std::pair<int, int>>& pathCells)
+{
+    m_version = grid.version();
+    m_types = grid.types();
+
+    m_path = pathCells;
+    m_pathMask.assign(m_types.size(), 0);
+    for (const auto& cell : m_path) {
+        if (grid.inBounds(cell.first, cell.second)) {
+            m_pathMask[grid.index(cell.first, cell.second)] = 1;
+        }
+    }
+
+    collectSpecialCells(grid);
+    m_texelsValid = false;
+}
+
+void BoardRenderer::rebuildRegion(const HexGrid& grid, const CellRange& visible, const Font& font)
+{
+    ++m_regionRebuilds;
+
+    if (m_detail == BoardDetail::Texels) {
+        // La textura cubre el mapa entero, asi que a este zoom moverse nunca rearma.
+        m_region = CellRange{ 0, m_rows, 0, m_cols };
+        if (!m_texelsValid) {
+            m_texels.rebuild(grid, m_pathMask);
+            m_texelsValid = true;
+        }
+        rebuildPathOverlay(font);
+        return;
+    }
+
+    // Fuera de este nivel los texeles no reciben los cambios.
+    m_texelsValid = false;
+    m_region = regionAround(visible);
+
+    // La capa estatica se redibuja entera, asi que aqui no hace falta marcar celdas.
+    m_mesh.rebuild(grid, m_layout, m_region);
+    for (const auto& cell : m_path) {
+        if (grid.inBounds(cell.first, cell.second)) {
+            m_mesh.setShadowVisible(grid.index(cell.first, cell.second), false);
+        }
+    }
+
+    rebuildPathOverlay(font);
+    if (m_detail == BoardDetail::Full) {
+        m_layer.redrawAll(grid, m_layout, m_region, m_pathMask, font);
+    }
+}
+
+// Margen alrededor de lo visible para que un pan corto o seguir al jugador no
+// obliguen a rearmar, sin pasarse del tamano maximo de textura de la capa estatica.
+CellRange BoardRenderer::regionAround(const CellRange& visible) const
+{
+    float maxTexture = static_cast<float>(Texture::getMaximumSize());
+    float reserve = m_layout.hexSize * 4;
+    float marginX = std::max(0.0f, std::min(REGION_MARGIN, (maxTexture - m_size.x) / 2 - reserve));
+    float marginY = std::max(0.0f, std::min(REGION_MARGIN, (maxTexture - m_size.y) / 2 - reserve));
+    int extraCols = static_cast<int>(marginX / m_layout.spacingX);
+    int extraRows = static_cast<int>(marginY / m_layout.spacingY);
+
+    CellRange region;
+    region.rowBegin = std::max(0, visible.rowBegin - extraRows);
+    region.rowEnd = std::min(m_rows, visible.rowEnd + extraRows);
+    region.colBegin = std::max(0, visible.colBegin - extraCols);
+    region.colEnd = std::min(m_cols, visible.colEnd + extraCols);
+    return region;
+}
+
+void BoardRenderer::setInPath(int cell, bool inPath)
+{
+    m_pathMask[cell] = inPath ? 1 : 0;
+    m_mesh.setShadowVisible(cell, !inPath);
+}
+
+// Solo la representacion del nivel actual sigue los cambios; las otras se rearman al volver a el.
+void BoardRenderer::markChanged(int cell)
+{
+    if (m_detail == BoardDetail::Texels) {
+        m_texels.markDirty(cell);
+    } else if (m_detail == BoardDetail::Full) {
+        m_layer.markDirty(cell);
+    }
+}
+
+// Las celdas que entran o salen del camino cambian de sombra y de etiqueta.
+void BoardRenderer::updatePath(const HexGrid& grid, const std::vector<std::pair<int, int>>& pathCells)
+{
+    for (const auto& cell : m_path) {
+        if (grid.inBounds(cell.first, cell.second)) {
+            int index = grid.index(cell.first, cell.second);
+            setInPath(index, false);
+            markChanged(index);
+        }
+    }
+
+    m_path = pathCells;
+    for (const auto& cell : m_path) {
+        if (grid.inBounds(cell.first, cell.second)) {
+            int index = grid.index(cell.first, cell.second);
+            setInPath(index, true);
+            markChanged(index);
+        }
+    }
+}
+
+void BoardRenderer::rebuildPathOverlay(const Font& font)
+{
+    m_pathOverlay.clear();
+    m_pathNumbers.clear();
+    if (m_path.empty() || m_detail == BoardDetail::Texels) {
+        return;
+    }
+
+    float hexSize = m_layout.hexSize;
+    float outerThickness = std::max(1.0f, hexSize * 0.1f);
+    for (const auto& cell : m_path) {
+        if (!m_region.contains(cell.first, cell.second)) {
+            continue;
+        }
+        Vector2f pos = m_layout.center(cell.first, cell.second);
+        appendHexRing(m_pathOverlay, pos, hexSize + 2, outerThickness, PATH_OUTLINE);
+        appendHexFill(m_pathOverlay, pos, hexSize - 1, PATH_FILL);
+        appendHexRing(m_pathOverlay, pos, hexSize - 1, 1, Color::White);
+    }
+
+    if (hexSize <= 12) {
+        return;
+    }
+
+    // Los fondos de los numeros van despues de todos los hexagonos, como antes.
+    for (const auto& cell : m_path) {
+        if (!m_region.contains(cell.first, cell.second)) {
+            continue;
+        }
+        appendCircle(m_pathOverlay, m_layout.center(cell.first, cell.second), hexSize * 0.4f,
+                     NUMBER_BACKGROUND, Color::White);
+    }
+
+    unsigned size = static_cast<unsigned>(hexSize * 0.5f);
+    if (!m_numberGlyphs.matches(font, size, true)) {
+        m_numberGlyphs.reset(font, size, true);
+    }
+
+    for (std::size_t i = 0; i < m_path.size(); ++i) {
+        if (!m_region.contains(m_path[i].first, m_path[i].second)) {
+            continue;
+        }
+        Vector2f pos = m_layout.center(m_path[i].first, m_path[i].second);
+        m_numberGlyphs.appendLabel(m_pathNumbers, std::to_string(i + 1), pos, Color::White);
+    }
+}
+
+void BoardRenderer::drawPath(RenderTarget& target) const
+{
+    if (m_pathOverlay.getVertexCount() > 0) {
+        drawCounted(target, m_pathOverlay, m_states);
+    }
+    if (m_pathNumbers.getVertexCount() > 0) {
+        RenderStates states(m_states);
+        states.texture = &m_numberGlyphs.texture();
+        drawCounted(target, m_pathNumbers, states);
+    }
+}
+
+void BoardRenderer::collectChangedCells(const HexGrid& grid)
+{
+    auto isSpecial = [](CellType type) { return type == CellType::START || type == CellType::GOAL; };
+    bool specialChanged = false;
+
+    // Normalmente basta con el diario del grid; si se quedo corto se compara todo.
+    bool journaled = grid.forEachChangeSince(m_version, [&](const CellChange& change) {
+        specialChanged |= isSpecial(change.oldType) || isSpecial(change.newType);
+        m_types[change.cell] = change.newType;
+        markChanged(change.cell);
+    });
+
+    if (!journaled) {
+        const std::vector<CellType>& types = grid.types();
+        for (std::size_t i = 0; i < types.size(); ++i) {
+            if (types[i] != m_types[i]) {
+                specialChanged |= isSpecial(m_types[i]) || isSpecial(types[i]);
+                m_types[i] = types[i];
+                markChanged(static_cast<int>(i));
+            }
+        }
+    }
+
+    if (specialChanged) {
+        collectSpecialCells(grid);
+    }
+    m_version = grid.version();
+}
+
+void BoardRenderer::collectSpecialCells(const HexGrid& grid)
+{
+    m_specialCells.clear();
+    for (std::size_t i = 0; i < grid.types().size(); ++i) {
+        CellType type = grid.types()[i];
+        if (type == CellType::START || type == CellType::GOAL) {
+            m_specialCells.push_back(static_cast<int>(i));
+        }
+    }
+}
+
+void BoardRenderer::draw(RenderTarget& target, const HexGrid& grid, float time)
+{
+    if (m_detail == BoardDetail::Texels) {
+        m_texels.draw(target, m_layout, m_states);
+        return;
+    }
+
+    m_palette.update(time);
+    m_mesh.updateColors(grid, m_palette);
+    m_mesh.draw(target, m_states);
+    if (m_detail == BoardDetail::Full) {
+        m_layer.draw(target, m_states);
+    }
+}
+
+void BoardRenderer::drawEffects(RenderTarget& target, const HexGrid& grid, float time)
+{
+    if (m_detail != BoardDetail::Full) {
+        return;
+    }
+
+    m_effects.clear();
+    for (int cell : m_specialCells) {
+        if (!m_region.contains(grid.rowOf(cell), grid.colOf(cell))) {
+            continue;
+        }
+        Vector2f pos = m_layout.center(grid.rowOf(cell), grid.colOf(cell));
+        appendCellEffects(m_effects, grid.types()[cell], pos, m_layout.hexSize, time);
+    }
+    drawCounted(target, m_effects, m_states);
+}
@@ -0,0 +1,107 @@
+#ifndef BOARD_RENDERER_HPP
+#define BOARD_RENDERER_HPP
+
+#include <SFML/Graphics.hpp>
+#include "BoardDetail.hpp"
+#include "BoardTexels.hpp"
+#include "CellPalette.hpp"
+#include "GlyphCache.hpp"
+#include "GridMesh.hpp"
+#include "HexLayout.hpp"
+#include "StaticBoardLayer.hpp"
+#include "model/HexGrid.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Tablero por capas: rellenos animados, capa estatica cacheada,
+ * efectos de START/GOAL y el camino; el jugador lo dibuja drawGrid encima.
+ *
+ * Mallas y capa estatica solo cubren una region: las celdas visibles con el
+ * layout del frame mas un margen. Si la camara se mueve dentro de esa region
+ * todo se dibuja trasladado sin rearmarse; se rearma al salir de ella o al
+ * cambiar el zoom o el tamano del destino.
+ *
+ * El nivel de detalle sale del tamano de los hexagonos (BoardDetail): de lejos
+ * el mapa entero es una textura de un texel por celda, a media distancia solo
+ * rellenos y camino, y de cerca todas las capas.
+ *
+ * Cuando cambia la version del grid las celdas a redibujar en la capa estatica
+ * salen del diario del grid. Solo si el diario ya no alcanza, o el grid es
+ * otro, se comparan los tipos con la copia del ultimo frame.
+ */
+class BoardRenderer
+{
+public:
+    // Fuerza a redibujar todo en el proximo frame, p. ej. al cargar otro mapa.
+    void invalidate() { m_grid = nullptr; }
+
+    void update(const model::HexGrid& grid, const HexLayout& layout, sf::Vector2u targetSize,
+                const std::vector<std::pair<int, int>>& pathCells, const sf::Font& font);
+
+    // Rellenos con la paleta del frame y la capa estatica encima.
+    void draw(sf::RenderTarget& target, const model::HexGrid& grid, float time);
+
+    // Efectos de START y GOAL en una sola llamada.
+    void drawEffects(sf::RenderTarget& target, const model::HexGrid& grid, float time);
+
+    // Hexagonos del camino con sus numeros de paso, en dos llamadas; la malla
+    // solo se arma cuando cambia el camino o la region.
+    void drawPath(sf::RenderTarget& target) const;
+
+    bool inPath(int cell) const { return m_pathMask[cell] != 0; }
+
+    std::size_t redrawnCells() const { return m_layer.lastRedrawCount(); }
+
+    BoardDetail detail() const { return m_detail; }
+
+    // Celdas armadas y cuantas veces se rearmo la region, para el benchmark.
+    const CellRange& region() const { return m_region; }
+    std::size_t regionRebuilds() const { return m_regionRebuilds; }
+
+private:
+    void resetGrid(const model::HexGrid& grid, const std::vector<std::pair<int, int>>& pathCells);
+    void rebuildRegion(const model::HexGrid& grid, const CellRange& visible, const sf::Font& font);
+    CellRange regionAround(const CellRange& visible) const;
+    void setInPath(int cell, bool inPath);
+    void markChanged(int cell);
+    void updatePath(const model::HexGrid& grid, const std::vector<std::pair<int, int>>& pathCells);
+    void rebuildPathOverlay(const sf::Font& font);
+    void collectChangedCells(const model::HexGrid& grid);
+    void collectSpecialCells(const model::HexGrid& grid);
+
+    const model::HexGrid* m_grid = nullptr;
+    int m_rows = 0;
+    int m_cols = 0;
+    unsigned long long m_version = 0;
+    sf::Vector2u m_size;
+
+    // Layout con el que se armo la region y traslado hasta el layout del frame.
+    HexLayout m_layout;
+    BoardDetail m_detail = BoardDetail::Full;
+    CellRange m_region;
+    sf::RenderStates m_states;
+    std::size_t m_regionRebuilds = 0;
+
+    // Copia de los tipos del ultimo frame, por si el diario del grid no alcanza.
+    std::vector<model::CellType> m_types;
+
+    std::vector<std::pair<int, int>> m_path;
+    std::vector<std::uint8_t> m_pathMask;
+    std::vector<int> m_specialCells;
+
+    sf::VertexArray m_pathOverlay{ sf::Triangles };
+    GlyphCache m_numberGlyphs;
+    sf::VertexArray m_pathNumbers{ sf::Triangles };
+
+    CellPalette m_palette;
+    sf::VertexArray m_effects{ sf::Triangles };
+    GridMesh m_mesh;
+    StaticBoardLayer m_layer;
+    BoardTexels m_texels;
+    bool m_texelsValid = false;
+};
+
+#endif
@@ -0,0 +1,81 @@
+#include "BoardTexels.hpp"
+#include "DrawCalls.hpp"
+
+using namespace model;
+using namespace sf;
+
+namespace {
+
+const Color PATH_TEXEL(255, 50, 50);
+
+// Con muchas celdas cambiadas sale mas barato subir la textura entera.
+constexpr std::size_t FULL_UPLOAD_FROM = 256;
+
+}
+
+bool BoardTexels::fits(const HexGrid& grid)
+{
+    unsigned maxSize = Texture::getMaximumSize();
+    return static_cast<unsigned>(grid.rows()) <= maxSize && static_cast<unsigned>(grid.cols()) <= maxSize;
+}
+
+void BoardTexels::rebuild(const HexGrid& grid, const std::vector<std::uint8_t>& pathMask)
+{
+    m_colors.update(0.0f);
+    m_pixels.resize(grid.types().size() * 4);
+    m_dirty.clear();
+
+    for (std::size_t i = 0; i < grid.types().size(); ++i) {
+        writeTexel(grid, pathMask, static_cast<int>(i));
+    }
+
+    if (m_texture.getSize() != Vector2u(grid.cols(), grid.rows())) {
+        m_texture.create(grid.cols(), grid.rows());
+    }
+    m_texture.update(m_pixels.data());
+}
+
+void BoardTexels::markDirty(int cell)
+{
+    m_dirty.push_back(cell);
+}
+
+void BoardTexels::flush(const HexGrid& grid, const std::vector<std::uint8_t>& pathMask)
+{
+    if (m_dirty.empty()) {
+        return;
+    }
+
+    for (int cell : m_dirty) {
+        writeTexel(grid, pathMask, cell);
+    }
+
+    if (m_dirty.size() >= FULL_UPLOAD_FROM) {
+        m_texture.update(m_pixels.data());
+    } else {
+        for (int cell : m_dirty) {
+            m_texture.update(&m_pixels[static_cast<std::size_t>(cell) * 4], 1, 1,
+                             grid.colOf(cell), grid.rowOf(cell));
+        }
+    }
+    m_dirty.clear();
+}
+
+void BoardTexels::writeTexel(const HexGrid& grid, const std::vector<std::uint8_t>& pathMask, int cell)
+{
+    Color color = pathMask[cell] ? PATH_TEXEL : m_colors[grid.types()[cell]];
+
+    Uint8* texel = &m_pixels[static_cast<std::size_t>(cell) * 4];
+    texel[0] = color.r;
+    texel[1] = color.g;
+    texel[2] = color.b;
+    texel[3] = color.a;
+}
+
+void BoardTexels::draw(RenderTarget& target, const HexLayout& layout, const RenderStates& states) const
+{
+    Sprite sprite(m_texture);
+    sprite.setScale(layout.spacingX, layout.spacingY);
+    sprite.setPosition(layout.offsetX - layout.spacingX * 0.5f, layout.offsetY - layout.spacingY * 0.5f);
+    drawCounted(target, sprite, states);
+}
@@ -0,0 +1,42 @@
+#ifndef BOARD_TEXELS_HPP
+#define BOARD_TEXELS_HPP
+
+#include <SFML/Graphics.hpp>
+#include "CellPalette.hpp"
+#include "HexLayout.hpp"
+#include "model/HexGrid.hpp"
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Mapa completo en una textura de un texel por celda, para el zoom mas lejano.
+ *
+ * Cada texel lleva el color base del tipo de la celda (o el del camino). Las
+ * celdas que cambian se marcan y se suben en la siguiente actualizacion.
+ */
+class BoardTexels
+{
+public:
+    // Falso si el mapa no entra en una textura de la GPU.
+    static bool fits(const model::HexGrid& grid);
+
+    void rebuild(const model::HexGrid& grid, const std::vector<std::uint8_t>& pathMask);
+
+    void markDirty(int cell);
+
+    void flush(const model::HexGrid& grid, const std::vector<std::uint8_t>& pathMask);
+
+    // Cada texel se estira al espaciado del layout, centrado en su celda.
+    void draw(sf::RenderTarget& target, const HexLayout& layout, const sf::RenderStates& states) const;
+
+private:
+    void writeTexel(const model::HexGrid& grid, const std::vector<std::uint8_t>& pathMask, int cell);
+
+    // Colores sin animar: a este zoom no se distinguiria el pulso.
+    CellPalette m_colors;
+    std::vector<sf::Uint8> m_pixels;
+    std::vector<int> m_dirty;
+    sf::Texture m_texture;
+};
+
+#endif
@@ -0,0 +1,70 @@
+#include "Camera.hpp"
+#include <algorithm>
+#include <cmath>
+
+using namespace sf;
+
+namespace {
+
+// El tablero se centra un poco por debajo del medio para dejar sitio al titulo, como fitLayout.
+constexpr float TITLE_OFFSET = 50.0f;
+
+// Tamano minimo de fitLayout: por debajo el mapa ya no se lee y pasa a seguir al jugador.
+constexpr float MIN_FIT_HEX_SIZE = 8.0f;
+
+}
+
+void Camera::pan(Vector2f pixels)
+{
+    HexLayout layout = scaledLayout(m_hexSize);
+    m_center.x += pixels.x / layout.spacingX;
+    m_center.y += pixels.y / layout.spacingY;
+    m_mode = Mode::Free;
+}
+
+void Camera::zoom(float factor)
+{
+    if (m_mode == Mode::Fit) {
+        m_mode = Mode::Free;
+    }
+    m_hexSize = std::max(MIN_HEX_SIZE, std::min(m_hexSize * factor, MAX_HEX_SIZE));
+}
+
+void Camera::setFollow(bool follow)
+{
+    m_mode = follow ? Mode::Follow : Mode::Free;
+}
+
+HexLayout Camera::update(Vector2u targetSize, int rows, int cols, Vector2f focus)
+{
+    if (m_mode == Mode::Fit) {
+        if (fitHexSize(targetSize, rows, cols) >= MIN_FIT_HEX_SIZE) {
+            // Se recuerda el encuadre para que el primer pan o zoom parta de lo que se ve.
+            HexLayout layout = fitLayout(targetSize, rows, cols);
+            m_hexSize = layout.hexSize;
+            m_center.x = (targetSize.x / 2.0f - layout.offsetX) / layout.spacingX;
+            m_center.y = (targetSize.y / 2.0f + TITLE_OFFSET - layout.offsetY) / layout.spacingY;
+            return layout;
+        }
+        m_mode = Mode::Follow;
+        m_hexSize = DEFAULT_HEX_SIZE;
+    }
+
+    if (m_mode == Mode::Follow) {
+        m_center = focus;
+    }
+
+    m_center.x = std::max(0.0f, std::min(m_center.x, static_cast<float>(cols)));
+    m_center.y = std::max(0.0f, std::min(m_center.y, static_cast<float>(rows - 1)));
+    return layoutAt(targetSize);
+}
+
+HexLayout Camera::layoutAt(Vector2u targetSize) const
+{
+    HexLayout layout = scaledLayout(m_hexSize);
+
+    // Offsets enteros: la capa estatica se compone pixel a pixel y no se difumina al moverse.
+    layout.offsetX = std::round(targetSize.x / 2.0f - m_center.x * layout.spacingX);
+    layout.offsetY = std::round(targetSize.y / 2.0f + TITLE_OFFSET - m_center.y * layout.spacingY);
+    return layout;
+}
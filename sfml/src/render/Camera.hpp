@@ -0,0 +1,54 @@
+#ifndef CAMERA_HPP
+#define CAMERA_HPP
+
+#include <SFML/Graphics.hpp>
+#include "HexLayout.hpp"
+
+/**
+ * @brief Encuadre del tablero: el mapa completo si cabe, y si no un tamano
+ * legible que sigue al jugador o que se mueve con pan y zoom.
+ *
+ * El centro se guarda en unidades de celda (columna, fila), asi el zoom no
+ * mueve el punto que se esta mirando.
+ */
+class Camera
+{
+public:
+    static constexpr float MIN_HEX_SIZE = 0.5f;
+    static constexpr float MAX_HEX_SIZE = 48.0f;
+    // Tamano con el que arranca un mapa que no cabe en la ventana.
+    static constexpr float DEFAULT_HEX_SIZE = 16.0f;
+
+    // Vuelve al encuadre automatico, p. ej. al cargar otro mapa.
+    void reset() { m_mode = Mode::Fit; }
+
+    // Desplaza la vista en pixeles de pantalla y deja de seguir al jugador.
+    void pan(sf::Vector2f pixels);
+
+    // Multiplica el tamano de los hexagonos manteniendo el centro.
+    void zoom(float factor);
+    float hexSize() const { return m_hexSize; }
+
+    void setFollow(bool follow);
+    bool following() const { return m_mode == Mode::Follow; }
+
+    // Layout del frame. `focus` es la posicion del jugador en unidades de celda.
+    HexLayout update(sf::Vector2u targetSize, int rows, int cols, sf::Vector2f focus);
+
+private:
+    enum class Mode { Fit, Follow, Free };
+
+    HexLayout layoutAt(sf::Vector2u targetSize) const;
+
+    Mode m_mode = Mode::Fit;
+    float m_hexSize = DEFAULT_HEX_SIZE;
+    sf::Vector2f m_center;
+};
+
+// Posicion de la celda en unidades de celda: la columna (media mas en filas impares) y la fila.
+inline sf::Vector2f cellPosition(int row, int col)
+{
+    return sf::Vector2f(col + (row % 2 == 1 ? 0.5f : 0.0f), static_cast<float>(row));
+}
+
+#endif
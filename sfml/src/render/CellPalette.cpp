@@ -0,0 +1,81 @@
+#include "CellPalette.hpp"
+#include <cmath>
+
+using namespace model;
+using namespace sf;
+
+namespace {
+
+const Color TECH_GRAY = Color(70, 90, 120);
+
+}
+
+Color cellColorAt(CellType type, float time) {
+    switch (type) {
+    case CellType::EMPTY:
+        return Color(220, 235, 255, 180);
+    case CellType::WALL: {
+        float pulse = sin(time * 1.5f) * 0.2f + 0.8f;
+        return Color(
+            static_cast<Uint8>(TECH_GRAY.r * pulse),
+            static_cast<Uint8>(TECH_GRAY.g * pulse),
+            static_cast<Uint8>(TECH_GRAY.b * pulse)
+        );
+    }
+    case CellType::START: {
+        // Más brillante y reconocible para la entrada con efecto pulsante
+        float pulse = sin(time * 4.0f) * 0.5f + 0.5f;
+        return Color(
+            static_cast<Uint8>(20 + 100 * pulse),
+            static_cast<Uint8>(150 + 105 * pulse),
+            static_cast<Uint8>(20 + 100 * pulse)
+        );
+    }
+    case CellType::GOAL: {
+        // Más brillante y reconocible para la meta con efecto pulsante
+        float pulse = sin(time * 3.5f) * 0.4f + 0.6f;
+        return Color(
+            static_cast<Uint8>(200 + 55 * pulse),
+            static_cast<Uint8>(150 + 105 * pulse),
+            static_cast<Uint8>(0)
+        );
+    }
+    case CellType::ITEM: {
+        // Sin parpadeo, color fijo para los items
+        return Color(180, 100, 255);
+    }
+    case CellType::UP_RIGHT: {
+        float flow = sin(time * 5.0f) * 0.3f + 0.7f;
+        return Color(255, static_cast<Uint8>(150 * flow), 0);
+    }
+    case CellType::RIGHT: {
+        float flow = sin(time * 5.0f + 1.0f) * 0.3f + 0.7f;
+        return Color(0, static_cast<Uint8>(200 * flow), 255);
+    }
+    case CellType::DOWN_RIGHT: {
+        float flow = sin(time * 5.0f + 2.0f) * 0.3f + 0.7f;
+        return Color(static_cast<Uint8>(180 * flow), 0, 255);
+    }
+    case CellType::DOWN_LEFT: {
+        float flow = sin(time * 5.0f + 3.0f) * 0.3f + 0.7f;
+        return Color(255, 0, static_cast<Uint8>(180 * flow));
+    }
+    case CellType::LEFT: {
+        float flow = sin(time * 5.0f + 4.0f) * 0.3f + 0.7f;
+        return Color(0, 255, static_cast<Uint8>(150 * flow));
+    }
+    case CellType::UP_LEFT: {
+        float flow = sin(time * 5.0f + 5.0f) * 0.3f + 0.7f;
+        return Color(255, 255, static_cast<Uint8>(100 * flow));
+    }
+    default:
+        return Color::White;
+    }
+}
+
+void CellPalette::update(float time)
+{
+    for (int i = 0; i < TYPE_COUNT; ++i) {
+        m_colors[i] = cellColorAt(static_cast<CellType>(i), time);
+    }
+}
@@ -0,0 +1,30 @@
+#ifndef CELL_PALETTE_HPP
+#define CELL_PALETTE_HPP
+
+#include <SFML/Graphics.hpp>
+#include "model/HexCell.hpp"
+#include <array>
+
+// Color de cada tipo de celda en el instante `time`; getCellColor y CellPalette lo comparten.
+sf::Color cellColorAt(model::CellType type, float time);
+
+/**
+ * @brief Tabla de colores por CellType, calculada una vez por frame.
+ *
+ * El color de una celda solo depende de su tipo y del tiempo, asi que basta
+ * con evaluar cada tipo una vez y despues copiar el color a cada vertice.
+ */
+class CellPalette
+{
+public:
+    static constexpr int TYPE_COUNT = static_cast<int>(model::CellType::DOWN_LEFT) + 1;
+
+    void update(float time);
+
+    const sf::Color& operator[](model::CellType type) const { return m_colors[static_cast<int>(type)]; }
+
+private:
+    std::array<sf::Color, TYPE_COUNT> m_colors;
+};
+
+#endif
@@ -0,0 +1,16 @@
+#ifndef DRAW_CALLS_HPP
+#define DRAW_CALLS_HPP
+
+#include <SFML/Graphics.hpp>
+#include "utils/Profiler.hpp"
+#include <utility>
+
+// target.draw que ademas suma la llamada al contador de dibujos del profiler.
+template <typename... Args>
+void drawCounted(sf::RenderTarget& target, Args&&... args)
+{
+    target.draw(std::forward<Args>(args)...);
+    utils::Profiler::countDrawCall();
+}
+
+#endif
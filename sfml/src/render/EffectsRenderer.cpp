@@ -1,6 +1,11 @@
 #include "EffectsRenderer.hpp"
+#include "DrawCalls.hpp"
+#include "GridMesh.hpp"
+#include <algorithm>
+#include <cmath>
 
 using namespace sf;
+using model::CellType;
 
 Color lerpColor(const Color& a, const Color& b, float t) {
     return Color(
@@ -11,7 +16,7 @@ Color lerpColor(const Color& a, const Color& b, float t) {
     );
 }
 
-void drawDecorativeHex(RenderWindow& window, Vector2f position, float size, Color color, float time, bool rotating) {
+void drawDecorativeHex(RenderTarget& window, Vector2f position, float size, Color color, float time, bool rotating) {
     CircleShape hex(size, 6);
     hex.setOrigin(size, size);
     hex.setPosition(position);
@@ -23,5 +28,28 @@ void drawDecorativeHex(RenderWindow& window, Vector2f position, float size, Colo
         hex.rotate(time * 30.0f);
     }
    
-    window.draw(hex);
-}
\ No newline at end of file
+    drawCounted(window, hex);
+}
+
+void appendCellEffects(VertexArray& batch, CellType type, Vector2f pos, float hexSize, float time) {
+    if (type == CellType::START) {
+        // Anillo pulsante verde y brillo interno
+        float ringPulse = std::sin(time * 6.0f) * 0.3f + 0.7f;
+        appendHexRing(batch, pos, hexSize + 3 * ringPulse, 3, Color(0, 255, 100, static_cast<Uint8>(150 * ringPulse)));
+        appendHexFill(batch, pos, hexSize * 0.7f, Color(0, 255, 100, static_cast<Uint8>(80 * ringPulse)));
+    }
+    else if (type == CellType::GOAL) {
+        // Anillo pulsante dorado, brillo interno y partículas alrededor
+        float ringPulse = std::sin(time * 5.0f) * 0.4f + 0.6f;
+        appendHexRing(batch, pos, hexSize + 4 * ringPulse, 4, Color(255, 215, 0, static_cast<Uint8>(180 * ringPulse)));
+        appendHexFill(batch, pos, hexSize * 0.8f, Color(255, 255, 0, static_cast<Uint8>(100 * ringPulse)));
+
+        for (int p = 0; p < 6; ++p) {
+            float angle = (p / 6.0f) * 2 * 3.14159f + time * 2.0f;
+            float radius = hexSize * 1.3f;
+            Vector2f sparkle(pos.x + std::cos(angle) * radius, pos.y + std::sin(angle) * radius);
+            float alpha = std::max(0.0f, 200 * std::sin(time * 8.0f + p));
+            appendHexFill(batch, sparkle, 2, Color(255, 255, 0, static_cast<Uint8>(alpha)));
+        }
+    }
+}
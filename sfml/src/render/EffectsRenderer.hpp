@@ -2,11 +2,16 @@
 #define EFFECTS_RENDERER_HPP
 
 #include <SFML/Graphics.hpp>
+#include "model/HexCell.hpp"
 
 using namespace sf;
 
 Color lerpColor(const Color& a, const Color& b, float t);
 
-void drawDecorativeHex(RenderWindow& window, Vector2f position, float size, Color color, float time, bool rotating = true);
+// Anillo, brillo y particulas de una celda START o GOAL, agregados al lote de
+// triangulos de efectos que se dibuja en una sola llamada.
+void appendCellEffects(VertexArray& batch, model::CellType type, Vector2f pos, float hexSize, float time);
+
+void drawDecorativeHex(RenderTarget& window, Vector2f position, float size, Color color, float time, bool rotating = true);
 
 #endif
\ No newline at end of file
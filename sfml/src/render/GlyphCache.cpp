@@ -0,0 +1,91 @@
+#include "GlyphCache.hpp"
+#include <algorithm>
+#include <limits>
+
+using namespace sf;
+
+void GlyphCache::reset(const Font& font, unsigned characterSize, bool bold)
+{
+    m_font = &font;
+    m_characterSize = characterSize;
+    m_bold = bold;
+    m_labels.clear();
+}
+
+const GlyphCache::Label& GlyphCache::label(const std::string& text)
+{
+    auto found = m_labels.find(text);
+    if (found != m_labels.end()) {
+        return found->second;
+    }
+
+    Label& result = m_labels[text];
+
+    // Mismo armado que sf::Text: un pixel de margen alrededor de cada glifo y
+    // limites calculados sin ese margen.
+    const float padding = 1.0f;
+    float x = 0.0f;
+    float y = static_cast<float>(m_characterSize);
+    float minX = std::numeric_limits<float>::max(), minY = std::numeric_limits<float>::max();
+    float maxX = std::numeric_limits<float>::lowest(), maxY = std::numeric_limits<float>::lowest();
+    Uint32 previous = 0;
+
+    for (unsigned char c : text) {
+        Uint32 current = c;
+        x += m_font->getKerning(previous, current, m_characterSize, m_bold);
+        previous = current;
+
+        const Glyph& glyph = m_font->getGlyph(current, m_characterSize, m_bold);
+
+        if (current == ' ') {
+            minX = std::min(minX, x);
+            minY = std::min(minY, y);
+            x += glyph.advance;
+            maxX = std::max(maxX, x);
+            maxY = std::max(maxY, y);
+            continue;
+        }
+
+        float left = glyph.bounds.left - padding;
+        float top = glyph.bounds.top - padding;
+        float right = glyph.bounds.left + glyph.bounds.width + padding;
+        float bottom = glyph.bounds.top + glyph.bounds.height + padding;
+
+        float u1 = static_cast<float>(glyph.textureRect.left) - padding;
+        float v1 = static_cast<float>(glyph.textureRect.top) - padding;
+        float u2 = static_cast<float>(glyph.textureRect.left + glyph.textureRect.width) + padding;
+        float v2 = static_cast<float>(glyph.textureRect.top + glyph.textureRect.height) + padding;
+
+        result.vertices.push_back(Vertex(Vector2f(x + left, y + top), Color::White, Vector2f(u1, v1)));
+        result.vertices.push_back(Vertex(Vector2f(x + right, y + top), Color::White, Vector2f(u2, v1)));
+        result.vertices.push_back(Vertex(Vector2f(x + left, y + bottom), Color::White, Vector2f(u1, v2)));
+        result.vertices.push_back(Vertex(Vector2f(x + left, y + bottom), Color::White, Vector2f(u1, v2)));
+        result.vertices.push_back(Vertex(Vector2f(x + right, y + top), Color::White, Vector2f(u2, v1)));
+        result.vertices.push_back(Vertex(Vector2f(x + right, y + bottom), Color::White, Vector2f(u2, v2)));
+
+        minX = std::min(minX, x + glyph.bounds.left);
+        maxX = std::max(maxX, x + glyph.bounds.left + glyph.bounds.width);
+        minY = std::min(minY, y + glyph.bounds.top);
+        maxY = std::max(maxY, y + glyph.bounds.top + glyph.bounds.height);
+
+        x += glyph.advance;
+    }
+
+    if (minX <= maxX) {
+        result.size = Vector2f(maxX - minX, maxY - minY);
+    }
+    return result;
+}
+
+void GlyphCache::appendLabel(VertexArray& batch, const std::string& text, Vector2f center, Color color)
+{
+    const Label& cached = label(text);
+    if (cached.vertices.empty()) {
+        return;
+    }
+
+    Vector2f origin(center.x - cached.size.x / 2, center.y - cached.size.y / 2);
+    for (const Vertex& vertex : cached.vertices) {
+        batch.append(Vertex(origin + vertex.position, color, vertex.texCoords));
+    }
+}
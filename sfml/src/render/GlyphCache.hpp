@@ -0,0 +1,46 @@
+#ifndef GLYPH_CACHE_HPP
+#define GLYPH_CACHE_HPP
+
+#include <SFML/Graphics.hpp>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief Quads de glifos por texto, para una fuente, tamano y estilo fijos.
+ *
+ * Cada texto distinto (tipo de celda o numero de paso) se arma una sola vez
+ * igual que lo haria sf::Text; despues solo se copian sus vertices
+ * desplazados a un lote que se dibuja con la textura de la fuente.
+ */
+class GlyphCache
+{
+public:
+    void reset(const sf::Font& font, unsigned characterSize, bool bold);
+
+    bool matches(const sf::Font& font, unsigned characterSize, bool bold) const
+    {
+        return m_font == &font && m_characterSize == characterSize && m_bold == bold;
+    }
+
+    // Agrega `text` centrado en `center`, como un sf::Text posicionado en center - limites / 2.
+    void appendLabel(sf::VertexArray& batch, const std::string& text, sf::Vector2f center, sf::Color color);
+
+    const sf::Texture& texture() const { return m_font->getTexture(m_characterSize); }
+
+private:
+    struct Label
+    {
+        std::vector<sf::Vertex> vertices;  // 6 por glifo, con la linea base en y = characterSize
+        sf::Vector2f size;
+    };
+
+    const Label& label(const std::string& text);
+
+    const sf::Font* m_font = nullptr;
+    unsigned m_characterSize = 0;
+    bool m_bold = false;
+    std::unordered_map<std::string, Label> m_labels;
+};
+
+#endif
@@ -0,0 +1,160 @@
+#include "GridMesh.hpp"
+#include "DrawCalls.hpp"
+#include <cmath>
+
+using namespace model;
+using namespace sf;
+
+namespace {
+
+// Esquinas de CircleShape(r, 6): la primera arriba y despues cada 60 grados.
+const Vector2f HEX_CORNERS[6] = {
+    Vector2f(0.0f, -1.0f),
+    Vector2f(0.8660254f, -0.5f),
+    Vector2f(0.8660254f, 0.5f),
+    Vector2f(0.0f, 1.0f),
+    Vector2f(-0.8660254f, 0.5f),
+    Vector2f(-0.8660254f, -0.5f),
+};
+
+// Distancia del centro a una arista sobre distancia a una esquina (cos 30).
+constexpr float APOTHEM_RATIO = 0.8660254f;
+
+const Color SHADOW_COLOR(0, 0, 0, 60);
+
+}
+
+void writeHexFill(VertexArray& vertices, std::size_t first, Vector2f center, float radius, Color color)
+{
+    Vector2f corner[6];
+    for (int i = 0; i < 6; ++i) {
+        corner[i] = center + HEX_CORNERS[i] * radius;
+    }
+
+    for (int t = 0; t < 4; ++t) {
+        vertices[first + t * 3] = Vertex(corner[0], color);
+        vertices[first + t * 3 + 1] = Vertex(corner[t + 1], color);
+        vertices[first + t * 3 + 2] = Vertex(corner[t + 2], color);
+    }
+}
+
+namespace {
+
+void writeRing(VertexArray& vertices, std::size_t first, Vector2f center, const Vector2f (&corners)[6],
+               float radius, float outer, Color color)
+{
+    for (int i = 0; i < 6; ++i) {
+        const Vector2f& a = corners[i];
+        const Vector2f& b = corners[(i + 1) % 6];
+        Vertex innerA(center + a * radius, color), outerA(center + a * outer, color);
+        Vertex innerB(center + b * radius, color), outerB(center + b * outer, color);
+
+        std::size_t v = first + i * 6;
+        vertices[v] = innerA;
+        vertices[v + 1] = outerA;
+        vertices[v + 2] = outerB;
+        vertices[v + 3] = innerA;
+        vertices[v + 4] = outerB;
+        vertices[v + 5] = innerB;
+    }
+}
+
+}
+
+void writeHexRing(VertexArray& vertices, std::size_t first, Vector2f center,
+                  float radius, float thickness, Color color)
+{
+    writeRing(vertices, first, center, HEX_CORNERS, radius, radius + thickness / APOTHEM_RATIO, color);
+}
+
+void writeHexRing(VertexArray& vertices, std::size_t first, Vector2f center,
+                  float radius, float thickness, Color color, float degrees)
+{
+    float radians = std::fmod(degrees, 360.0f) * 3.14159265f / 180.0f;
+    float c = std::cos(radians), s = std::sin(radians);
+
+    Vector2f corners[6];
+    for (int i = 0; i < 6; ++i) {
+        const Vector2f& p = HEX_CORNERS[i];
+        corners[i] = Vector2f(p.x * c - p.y * s, p.x * s + p.y * c);
+    }
+    writeRing(vertices, first, center, corners, radius, radius + thickness / APOTHEM_RATIO, color);
+}
+
+void appendHexFill(VertexArray& batch, Vector2f center, float radius, Color color)
+{
+    std::size_t first = batch.getVertexCount();
+    batch.resize(first + GridMesh::FILL_VERTICES);
+    writeHexFill(batch, first, center, radius, color);
+}
+
+void appendHexRing(VertexArray& batch, Vector2f center, float radius, float thickness, Color color)
+{
+    std::size_t first = batch.getVertexCount();
+    batch.resize(first + GridMesh::OUTLINE_VERTICES);
+    writeHexRing(batch, first, center, radius, thickness, color);
+}
+
+void GridMesh::rebuild(const HexGrid& grid, const HexLayout& layout, const CellRange& region)
+{
+    m_region = region;
+    m_gridCols = grid.cols();
+
+    std::size_t cells = static_cast<std::size_t>(region.rows()) * region.cols();
+    float hexSize = layout.hexSize;
+
+    m_shadows = hexSize > 10;
+    m_shadowVertices.resize(m_shadows ? cells * FILL_VERTICES : 0);
+    m_fills.resize(cells * FILL_VERTICES);
+
+    std::size_t i = 0;
+    for (int row = region.rowBegin; row < region.rowEnd; ++row) {
+        for (int col = region.colBegin; col < region.colEnd; ++col, ++i) {
+            Vector2f center = layout.center(row, col);
+
+            if (m_shadows) {
+                writeHexFill(m_shadowVertices, i * FILL_VERTICES, center + Vector2f(1, 1), hexSize, SHADOW_COLOR);
+            }
+            writeHexFill(m_fills, i * FILL_VERTICES, center, hexSize, Color::White);
+        }
+    }
+}
+
+void GridMesh::setShadowVisible(int cell, bool visible)
+{
+    int row = cell / m_gridCols, col = cell % m_gridCols;
+    if (!m_shadows || !m_region.contains(row, col)) {
+        return;
+    }
+
+    std::size_t local = static_cast<std::size_t>(row - m_region.rowBegin) * m_region.cols() + (col - m_region.colBegin);
+    Color color = visible ? SHADOW_COLOR : Color::Transparent;
+    for (std::size_t v = local * FILL_VERTICES; v < (local + 1) * FILL_VERTICES; ++v) {
+        m_shadowVertices[v].color = color;
+    }
+}
+
+void GridMesh::updateColors(const HexGrid& grid, const CellPalette& palette)
+{
+    if (m_region.empty()) {
+        return;
+    }
+
+    const std::vector<CellType>& types = grid.types();
+    std::size_t v = 0;
+    for (int row = m_region.rowBegin; row < m_region.rowEnd; ++row) {
+        const CellType* type = &types[grid.index(row, m_region.colBegin)];
+        for (int col = m_region.colBegin; col < m_region.colEnd; ++col, ++type) {
+            const Color& color = palette[*type];
+            for (std::size_t end = v + FILL_VERTICES; v < end; ++v) {
+                m_fills[v].color = color;
+            }
+        }
+    }
+}
+
+void GridMesh::draw(RenderTarget& target, const RenderStates& states) const
+{
+    drawCounted(target, m_shadowVertices, states);
+    drawCounted(target, m_fills, states);
+}
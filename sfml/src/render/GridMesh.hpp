@@ -0,0 +1,59 @@
+#ifndef GRID_MESH_HPP
+#define GRID_MESH_HPP
+
+#include <SFML/Graphics.hpp>
+#include "CellPalette.hpp"
+#include "HexLayout.hpp"
+#include "model/HexGrid.hpp"
+#include <cstddef>
+
+/**
+ * @brief Sombras y rellenos del tablero en dos VertexArray.
+ *
+ * Solo cubre las celdas de `region` (lo visible mas un margen). La geometria
+ * depende de la region y del layout; los cambios de tipo de una celda solo
+ * cambian su color, que se refresca cada frame.
+ */
+class GridMesh
+{
+public:
+    static constexpr int FILL_VERTICES = 12;     // 4 triangulos por hexagono
+    static constexpr int OUTLINE_VERTICES = 36;  // 6 trapecios de 2 triangulos
+
+    void rebuild(const model::HexGrid& grid, const HexLayout& layout, const CellRange& region);
+
+    // Las celdas del camino no llevan sombra. Se ignoran las celdas fuera de la region.
+    void setShadowVisible(int cell, bool visible);
+
+    // Copia a cada vertice el color de su tipo; no evalua ninguna animacion.
+    void updateColors(const model::HexGrid& grid, const CellPalette& palette);
+
+    void draw(sf::RenderTarget& target, const sf::RenderStates& states) const;
+
+private:
+    CellRange m_region;
+    int m_gridCols = 1;
+    bool m_shadows = false;
+    sf::VertexArray m_shadowVertices{ sf::Triangles };
+    sf::VertexArray m_fills{ sf::Triangles };
+};
+
+// Vertices de un hexagono (punta arriba, como CircleShape(r, 6)) a partir de `first`.
+void writeHexFill(sf::VertexArray& vertices, std::size_t first, sf::Vector2f center, float radius, sf::Color color);
+
+// Anillo entre dos radios; el borde exterior queda `thickness` por fuera, como setOutlineThickness.
+void writeHexRing(sf::VertexArray& vertices, std::size_t first, sf::Vector2f center,
+                  float radius, float thickness, sf::Color color);
+
+// Igual, girado `degrees` alrededor del centro como CircleShape::rotate.
+void writeHexRing(sf::VertexArray& vertices, std::size_t first, sf::Vector2f center,
+                  float radius, float thickness, sf::Color color, float degrees);
+
+// Agregan el hexagono al final de un lote de triangulos.
+void appendHexFill(sf::VertexArray& batch, sf::Vector2f center, float radius, sf::Color color);
+void appendHexRing(sf::VertexArray& batch, sf::Vector2f center, float radius, float thickness, sf::Color color);
+
+// Grosor del borde de cada hexagono para un tamano dado.
+inline float hexOutlineThickness(float hexSize) { return hexSize * 0.08f > 2.0f ? hexSize * 0.08f : 2.0f; }
+
+#endif
@@ -0,0 +1,54 @@
+#include "HexLayout.hpp"
+#include <algorithm>
+#include <cmath>
+
+HexLayout scaledLayout(float hexSize)
+{
+    HexLayout layout;
+    layout.hexSize = hexSize;
+
+    // Espaciado corregido - más espacio horizontal, menos vertical
+    layout.spacingX = hexSize * 1.8f;
+    layout.spacingY = hexSize * std::sqrt(3.0f) * 1.02f;
+    return layout;
+}
+
+float fitHexSize(sf::Vector2u targetSize, int rows, int cols)
+{
+    float hexSizeByWidth = (targetSize.x - 200.0f) / (cols * 1.5f + 0.5f);
+    float hexSizeByHeight = (targetSize.y - 200.0f) / (rows * std::sqrt(3.0f));
+    return std::min(hexSizeByWidth, hexSizeByHeight);
+}
+
+HexLayout fitLayout(sf::Vector2u targetSize, int rows, int cols)
+{
+    float width = static_cast<float>(targetSize.x);
+    float height = static_cast<float>(targetSize.y);
+
+    HexLayout layout = scaledLayout(std::max(8.0f, std::min(fitHexSize(targetSize, rows, cols), 25.0f)));
+
+    float gridWidth = (cols - 1) * layout.spacingX + layout.hexSize * 2;
+    float gridHeight = (rows - 1) * layout.spacingY + layout.hexSize * 2;
+
+    layout.offsetX = (width - gridWidth) / 2.0f;
+    layout.offsetY = (height - gridHeight) / 2.0f + 50.0f;
+    return layout;
+}
+
+CellRange visibleCells(const HexLayout& layout, sf::Vector2u targetSize, int rows, int cols, float margin)
+{
+    // Las filas impares van media columna a la derecha, asi que se toma el rango
+    // que cubre a las dos y se agrega el radio del hexagono por cada lado.
+    float extent = layout.hexSize + margin;
+    float left = -extent - layout.offsetX - layout.spacingX * 0.5f;
+    float right = targetSize.x + extent - layout.offsetX;
+    float top = -extent - layout.offsetY;
+    float bottom = targetSize.y + extent - layout.offsetY;
+
+    CellRange range;
+    range.colBegin = std::max(0, static_cast<int>(std::floor(left / layout.spacingX)) + 1);
+    range.colEnd = std::min(cols, static_cast<int>(std::floor(right / layout.spacingX)) + 1);
+    range.rowBegin = std::max(0, static_cast<int>(std::floor(top / layout.spacingY)) + 1);
+    range.rowEnd = std::min(rows, static_cast<int>(std::floor(bottom / layout.spacingY)) + 1);
+    return range;
+}
@@ -0,0 +1,67 @@
+#ifndef HEX_LAYOUT_HPP
+#define HEX_LAYOUT_HPP
+
+#include <SFML/Graphics.hpp>
+
+// Posicion en pantalla de cada hexagono (filas impares desplazadas media celda).
+struct HexLayout
+{
+    float hexSize = 0.0f;
+    float spacingX = 0.0f;
+    float spacingY = 0.0f;
+    float offsetX = 0.0f;
+    float offsetY = 0.0f;
+
+    sf::Vector2f center(int row, int col) const
+    {
+        return sf::Vector2f(offsetX + col * spacingX + (row % 2 == 1 ? spacingX * 0.5f : 0.0f),
+                            offsetY + row * spacingY);
+    }
+
+    bool operator==(const HexLayout& other) const
+    {
+        return hexSize == other.hexSize && spacingX == other.spacingX && spacingY == other.spacingY &&
+               offsetX == other.offsetX && offsetY == other.offsetY;
+    }
+
+    bool operator!=(const HexLayout& other) const { return !(*this == other); }
+};
+
+// Celdas [rowBegin, rowEnd) x [colBegin, colEnd) de un grid.
+struct CellRange
+{
+    int rowBegin = 0;
+    int rowEnd = 0;
+    int colBegin = 0;
+    int colEnd = 0;
+
+    int rows() const { return rowEnd - rowBegin; }
+    int cols() const { return colEnd - colBegin; }
+    bool empty() const { return rowEnd <= rowBegin || colEnd <= colBegin; }
+
+    bool contains(int row, int col) const
+    {
+        return row >= rowBegin && row < rowEnd && col >= colBegin && col < colEnd;
+    }
+
+    bool contains(const CellRange& other) const
+    {
+        return other.empty() || (other.rowBegin >= rowBegin && other.rowEnd <= rowEnd &&
+                                 other.colBegin >= colBegin && other.colEnd <= colEnd);
+    }
+};
+
+// Espaciado para un tamano de hexagono, con el origen en (0, 0).
+HexLayout scaledLayout(float hexSize);
+
+// Tamano con el que el mapa completo cabe en el destino, sin limites.
+float fitHexSize(sf::Vector2u targetSize, int rows, int cols);
+
+// Ajusta el mapa completo al destino y lo centra debajo del titulo.
+HexLayout fitLayout(sf::Vector2u targetSize, int rows, int cols);
+
+// Celdas cuyo hexagono, agrandado `margin` pixeles, toca el rectangulo del destino.
+// Se calcula directo de las coordenadas offset, sin recorrer el grid.
+CellRange visibleCells(const HexLayout& layout, sf::Vector2u targetSize, int rows, int cols, float margin);
+
+#endif
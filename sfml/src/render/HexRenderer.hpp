@@ -2,6 +2,8 @@
 #define HEX_RENDERER_HPP
 
 #include <SFML/Graphics.hpp>
+#include "BoardRenderer.hpp"
+#include "Camera.hpp"
 #include "model/HexGrid.hpp"
 #include "model/Player.hpp"
 #include <vector>
@@ -13,9 +15,12 @@ CircleShape createHexagon();
 
 Color getCellColor(CellType type, Clock& animClock);
 
-void drawGrid(RenderWindow& window, const HexGrid& grid,
-    Player& player, CircleShape& hexagon,
-    Text& text, Font& font, Clock& animClock, Clock& bgClock,
-    std::vector<std::pair<int, int>>& pathCells);
+// Tablero por capas (BoardRenderer) y encima efectos, camino y jugador, encuadrado por la camara.
+// El movimiento del jugador lo avanza la simulacion; `alpha` es la fraccion del tick en curso
+// con la que se interpola su posicion.
+void drawGrid(RenderTarget& target, const HexGrid& grid,
+    Player& player, BoardRenderer& board, Camera& camera,
+    Font& font, Clock& animClock, Clock& bgClock,
+    const std::vector<std::pair<int, int>>& pathCells, float alpha = 1.0f);
 
 #endif
\ No newline at end of file
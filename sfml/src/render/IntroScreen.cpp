@@ -1,87 +1,62 @@
 #include "IntroScreen.hpp"
+#include "AnimatedBackground.hpp"
 #include <vector>
 #include <cmath>
 
 using namespace sf;
 
-void mostrarIntro(RenderWindow& window, Font& font) {
-    static Clock introClock;
-    float time = introClock.getElapsedTime().asSeconds();
+const BackgroundStyle INTRO_BACKGROUND = {
+    Color(10, 20, 50), Color(20, 40, 80), Color(30, 50, 100), 1.5f, 0.3f, 3
+};
+
+void drawIntroBackground(RenderTarget& window, float time) {
+    static AnimatedBackground background(INTRO_BACKGROUND);
+    static DecorativeHexBatch hexes;
+
     float windowWidth = static_cast<float>(window.getSize().x);
     float windowHeight = static_cast<float>(window.getSize().y);
-    float centerX = windowWidth / 2.0f;
-    float centerY = windowHeight / 2.0f;
-    
-    for (int i = 0; i < window.getSize().y; i += 3) {
-        float gradient = static_cast<float>(i) / window.getSize().y;
-        float wave = sin(time * 1.5f + gradient * 8.0f) * 0.3f + 0.7f;
-        
-        Color topColor(10, 20, 50);
-        Color midColor(20, 40, 80);
-        Color bottomColor(30, 50, 100);
-        
-        Color currentColor;
-        if (gradient < 0.5f) {
-            float t = gradient * 2.0f * wave;
-            currentColor = Color(
-                static_cast<Uint8>(topColor.r + (midColor.r - topColor.r) * t),
-                static_cast<Uint8>(topColor.g + (midColor.g - topColor.g) * t),
-                static_cast<Uint8>(topColor.b + (midColor.b - topColor.b) * t)
-            );
-        } else {
-            float t = (gradient - 0.5f) * 2.0f * wave;
-            currentColor = Color(
-                static_cast<Uint8>(midColor.r + (bottomColor.r - midColor.r) * t),
-                static_cast<Uint8>(midColor.g + (bottomColor.g - midColor.g) * t),
-                static_cast<Uint8>(midColor.b + (bottomColor.b - midColor.b) * t)
-            );
-        }
-        
-        RectangleShape line(Vector2f(windowWidth, 3));
-        line.setPosition(0, static_cast<float>(i));
-        line.setFillColor(currentColor);
-        window.draw(line);
-    }
-    
+
+    background.update(window.getSize(), time);
+    background.draw(window);
+
+    hexes.clear();
     for (int i = 0; i < 30; ++i) {
         float x = fmod(time * 25.0f + i * 45.0f, windowWidth + 80.0f) - 40.0f;
         float y = 60.0f + sin(time * 0.8f + i * 0.4f) * 25.0f + i * 18.0f;
-        
+
         if (y < windowHeight) {
-            CircleShape hex(3 + (i % 4), 6);
-            hex.setOrigin(3 + (i % 4), 3 + (i % 4));
-            hex.setPosition(x, y);
-            hex.setFillColor(Color::Transparent);
-            
             Color hexColor;
             if (i % 4 == 0) hexColor = Color(0, 200, 255, 60);
             else if (i % 4 == 1) hexColor = Color(0, 255, 150, 60);
             else if (i % 4 == 2) hexColor = Color(180, 100, 255, 60);
             else hexColor = Color(255, 150, 0, 60);
-            
-            hex.setOutlineColor(hexColor);
-            hex.setOutlineThickness(1);
-            hex.rotate(time * 30.0f * (i + 1));
-            window.draw(hex);
+
+            hexes.add(Vector2f(x, y), 3 + (i % 4), 1, hexColor, time * 30.0f * (i + 1));
         }
     }
-    
+
+    // Hexagonos que giran detras del titulo
+    Vector2f titleCenter(windowWidth / 2.0f, windowHeight / 2.0f - 200);
     for (int i = 0; i < 3; ++i) {
-        CircleShape titleHex(80 + i * 15, 6);
-        titleHex.setOrigin(80 + i * 15, 80 + i * 15);
-        titleHex.setPosition(centerX, centerY - 200);
-        titleHex.setFillColor(Color::Transparent);
-        
         Color hexColor;
         if (i == 0) hexColor = Color(255, 255, 0, 120);
         else if (i == 1) hexColor = Color(0, 200, 255, 100);
         else hexColor = Color(180, 100, 255, 80);
-        
-        titleHex.setOutlineColor(hexColor);
-        titleHex.setOutlineThickness(2);
-        titleHex.rotate(time * 12.0f * (i + 1));
-        window.draw(titleHex);
+
+        hexes.add(titleCenter, 80 + i * 15, 2, hexColor, time * 12.0f * (i + 1));
     }
+    hexes.draw(window);
+}
+
+void mostrarIntro(RenderTarget& window, Font& font) {
+    static Clock introClock;
+    float time = introClock.getElapsedTime().asSeconds();
+    float windowWidth = static_cast<float>(window.getSize().x);
+    float windowHeight = static_cast<float>(window.getSize().y);
+    float centerX = windowWidth / 2.0f;
+    float centerY = windowHeight / 2.0f;
+    
+    drawIntroBackground(window, time);
     
     Text titulo;
     titulo.setFont(font);
@@ -298,25 +273,21 @@ void mostrarIntro(RenderWindow& window, Font& font) {
     startText.setPosition(centerX, centerY + 350);
     window.draw(startText);
     
+    static DecorativeHexBatch buttonHexes;
+    buttonHexes.clear();
     for (int i = 0; i < 8; ++i) {
         float angle = (i / 8.0f) * 2 * 3.14159f;
         float x = centerX + cos(angle + time * 2.0f) * 120;
         float y = centerY + 350 + sin(angle + time * 2.0f) * 15;
         
-        CircleShape hexDeco(6, 6);
-        hexDeco.setOrigin(6, 6);
-        hexDeco.setPosition(x, y);
-        hexDeco.setFillColor(Color::Transparent);
-        hexDeco.setOutlineColor(Color(
+        buttonHexes.add(Vector2f(x, y), 6, 2, Color(
             static_cast<Uint8>(100 + 155 * startPulse),
             static_cast<Uint8>(150 + 105 * startPulse),
             255,
             static_cast<Uint8>(150 * startPulse)
-        ));
-        hexDeco.setOutlineThickness(2);
-        hexDeco.rotate(time * 90.0f);
-        window.draw(hexDeco);
+        ), time * 90.0f);
     }
+    buttonHexes.draw(window);
     
     RectangleShape bottomLine1(Vector2f(200, 2));
     bottomLine1.setOrigin(100, 1);
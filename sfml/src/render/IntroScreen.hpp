@@ -3,6 +3,9 @@
 
 #include <SFML/Graphics.hpp>
 
-void mostrarIntro(sf::RenderWindow& window, sf::Font& font);
+void mostrarIntro(sf::RenderTarget& window, sf::Font& font);
 
-#endif 
\ No newline at end of file
+// Degradado, hexagonos flotantes y los del titulo en dos llamadas de dibujo.
+void drawIntroBackground(sf::RenderTarget& window, float time);
+
+#endif
@@ -4,6 +4,9 @@
 #include "model/HexGrid.hpp"
 #include "model/Player.hpp"
 #include "core/PathFinding.hpp"
+#include "render/BoardRenderer.hpp"
+#include "render/Camera.hpp"
+#include "utils/Profiler.hpp"
 #include <vector>
 
 sf::CircleShape createHexagon();
@@ -12,20 +15,24 @@ sf::Color lerpColor(const sf::Color& a, const sf::Color& b, float t);
 
 void drawVictoryScreen(sf::RenderWindow& window, sf::Font& font, float winTime, int turnCount, sf::Clock& animClock);
 
-void drawAnimatedBackground(sf::RenderWindow& window, sf::Clock& bgClock);
+void drawAnimatedBackground(sf::RenderTarget& window, sf::Clock& bgClock);
 
-void drawGameTitle(sf::RenderWindow& window, sf::Font& font, sf::Clock& animClock);
+void drawGameTitle(sf::RenderTarget& window, sf::Font& font, sf::Clock& animClock);
 
 void drawModernEnergyBar(sf::RenderWindow& window, const model::Player& player, sf::Font& font, sf::Clock& animClock);
 
 void drawGameInfo(sf::RenderWindow& window, sf::Font& font, int turnCount, sf::Clock& animClock,
-                 bool showPathVisualization = false, bool autoSolveMode = false);
+                 bool showPathVisualization = false, bool autoSolveMode = false,
+                 bool solving = false);
 
 void drawModernControls(sf::RenderWindow& window, sf::Font& font, sf::Clock& animClock);
 
+void drawProfilerOverlay(sf::RenderWindow& window, sf::Font& font, const utils::Profiler& profiler, double tickRate,
+                         double droppedSeconds);
+
 sf::Color getCellColor(model::CellType type, sf::Clock& animClock);
 
-void drawGrid(sf::RenderWindow& window, const model::HexGrid& grid,
-    model::Player& player, sf::CircleShape& hexagon,
-    sf::Text& texto, sf::Font& font, sf::Clock& animClock, sf::Clock& bgClock,
-    std::vector<std::pair<int, int>>& path);
\ No newline at end of file
+void drawGrid(sf::RenderTarget& window, const model::HexGrid& grid,
+    model::Player& player, BoardRenderer& board, Camera& camera,
+    sf::Font& font, sf::Clock& animClock, sf::Clock& bgClock,
+    const std::vector<std::pair<int, int>>& path, float alpha);
\ No newline at end of file
@@ -1,4 +1,6 @@
 #include "ScreenRenderer.hpp"
+#include "DrawCalls.hpp"
+#include "AnimatedBackground.hpp"
 #include "EffectsRenderer.hpp"
 #include <cmath>
 #include <vector>
@@ -25,7 +27,7 @@ void drawVictoryScreen(RenderWindow& window, Font& font, float winTime, int turn
         RectangleShape line(Vector2f(window.getSize().x, 4));
         line.setPosition(0, i);
         line.setFillColor(currentColor);
-        window.draw(line);
+        drawCounted(window, line);
     }
 
     for (int i = 0; i < 20; ++i) {
@@ -57,7 +59,7 @@ void drawVictoryScreen(RenderWindow& window, Font& font, float winTime, int turn
         mainHex.setOutlineColor(hexColor);
         mainHex.setOutlineThickness(3);
         mainHex.rotate(time * 20.0f * (i + 1));
-        window.draw(mainHex);
+        drawCounted(window, mainHex);
     }
 
     RectangleShape centerPanel(Vector2f(400, 250));
@@ -66,7 +68,7 @@ void drawVictoryScreen(RenderWindow& window, Font& font, float winTime, int turn
     centerPanel.setFillColor(Color(20, 40, 80, 200));
     centerPanel.setOutlineColor(NEON_BLUE);
     centerPanel.setOutlineThickness(2);
-    window.draw(centerPanel);
+    drawCounted(window, centerPanel);
 
     Text victoryTitle;
     victoryTitle.setFont(font);
@@ -84,7 +86,7 @@ void drawVictoryScreen(RenderWindow& window, Font& font, float winTime, int turn
         static_cast<Uint8>(ELECTRIC_YELLOW.g * titleGlow),
         static_cast<Uint8>(ELECTRIC_YELLOW.b)
     ));
-    window.draw(victoryTitle);
+    drawCounted(window, victoryTitle);
 
     Text timeText;
     timeText.setFont(font);
@@ -95,7 +97,7 @@ void drawVictoryScreen(RenderWindow& window, Font& font, float winTime, int turn
     timeText.setOrigin(timeTextBounds.width / 2, timeTextBounds.height / 2);
     timeText.setPosition(centerX, centerY + 15);
     timeText.setFillColor(NEON_GREEN);
-    window.draw(timeText);
+    drawCounted(window, timeText);
 
     Text turnsText;
     turnsText.setFont(font);
@@ -106,7 +108,7 @@ void drawVictoryScreen(RenderWindow& window, Font& font, float winTime, int turn
     turnsText.setOrigin(turnsTextBounds.width / 2, turnsTextBounds.height / 2);
     turnsText.setPosition(centerX, centerY + 35);
     turnsText.setFillColor(NEON_BLUE);
-    window.draw(turnsText);
+    drawCounted(window, turnsText);
 
     Text exitText;
     exitText.setFont(font);
@@ -119,10 +121,10 @@ void drawVictoryScreen(RenderWindow& window, Font& font, float winTime, int turn
    
     float exitAlpha = sin(time * 3.0f) * 100 + 155;
     exitText.setFillColor(Color(CYBER_WHITE.r, CYBER_WHITE.g, CYBER_WHITE.b, static_cast<Uint8>(exitAlpha)));
-    window.draw(exitText);
+    drawCounted(window, exitText);
 }
 
-void drawGameTitle(RenderWindow& window, Font& font, Clock& animClock) {
+void drawGameTitle(RenderTarget& window, Font& font, Clock& animClock) {
     float time = animClock.getElapsedTime().asSeconds();
 
     float centerX = window.getSize().x / 2.0f;
@@ -148,7 +150,7 @@ void drawGameTitle(RenderWindow& window, Font& font, Clock& animClock) {
 
     titleText.setPosition(titleX, titleY);
     titleText.setFillColor(ELECTRIC_YELLOW);
-    window.draw(titleText);
+    drawCounted(window, titleText);
 
     Text subtitleText;
     subtitleText.setFont(font);
@@ -162,56 +164,45 @@ void drawGameTitle(RenderWindow& window, Font& font, Clock& animClock) {
     RectangleShape leftLine(Vector2f(80, 2));
     leftLine.setPosition(subtitleX - 90, subtitleY + 8);
     leftLine.setFillColor(NEON_BLUE);
-    window.draw(leftLine);
+    drawCounted(window, leftLine);
 
     subtitleText.setPosition(subtitleX, subtitleY);
     subtitleText.setFillColor(CYBER_WHITE);
-    window.draw(subtitleText);
+    drawCounted(window, subtitleText);
 
     RectangleShape rightLine(Vector2f(80, 2));
     rightLine.setPosition(subtitleX + subtitleBounds.width + 10, subtitleY + 8);
     rightLine.setFillColor(NEON_BLUE);
-    window.draw(rightLine);
+    drawCounted(window, rightLine);
 }
 
-void drawAnimatedBackground(RenderWindow& window, Clock& bgClock) {
-    float time = bgClock.getElapsedTime().asSeconds();
+const BackgroundStyle GAME_BACKGROUND = {
+    Color(15, 25, 60), Color(25, 45, 90), Color(35, 55, 110), 2.0f, 0.2f, 3
+};
 
-    for (int i = 0; i < window.getSize().y; i += 3) {
-        float gradient = static_cast<float>(i) / window.getSize().y;
-        float wave = sin(time * 2.0f + gradient * 8.0f) * 0.2f + 0.8f;
-       
-        Color topColor(15, 25, 60);
-        Color midColor(25, 45, 90);
-        Color bottomColor(35, 55, 110);
-       
-        Color currentColor;
-        if (gradient < 0.5f) {
-            currentColor = lerpColor(topColor, midColor, gradient * 2.0f * wave);
-        } else {
-            currentColor = lerpColor(midColor, bottomColor, (gradient - 0.5f) * 2.0f * wave);
-        }
+void drawAnimatedBackground(RenderTarget& window, Clock& bgClock) {
+    static AnimatedBackground background(GAME_BACKGROUND);
+    static DecorativeHexBatch floatingHexes;
 
-        RectangleShape line(Vector2f(window.getSize().x, 3));
-        line.setPosition(0, i);
-        line.setFillColor(currentColor);
-        window.draw(line);
-    }
+    float time = bgClock.getElapsedTime().asSeconds();
+    background.update(window.getSize(), time);
+    background.draw(window);
 
+    floatingHexes.clear();
     for (int i = 0; i < 25; ++i) {
         float x = fmod(time * 40.0f + i * 50.0f, window.getSize().x + 100.0f) - 50.0f;
         float y = 100.0f + sin(time * 1.2f + i * 0.5f) * 40.0f + i * 20.0f;
-       
+
         if (y < window.getSize().y) {
             Color hexColor;
             if (i % 4 == 0) hexColor = NEON_BLUE;
             else if (i % 4 == 1) hexColor = NEON_GREEN;
             else if (i % 4 == 2) hexColor = NEON_PURPLE;
             else hexColor = NEON_ORANGE;
-           
+
             hexColor.a = 80 + (i % 50);
-            drawDecorativeHex(window, Vector2f(x, y), 3 + (i % 3), hexColor, time * 60.0f);
+            floatingHexes.add(Vector2f(x, y), 3 + (i % 3), 2, hexColor, time * 60.0f * 30.0f);
         }
     }
+    floatingHexes.draw(window);
 }
-
@@ -7,9 +7,10 @@ using namespace sf;
 
 void drawVictoryScreen(RenderWindow& window, Font& font, float winTime, int turnCount, Clock& animClock);
 
-void drawGameTitle(RenderWindow& window, Font& font, Clock& animClock);
+void drawGameTitle(RenderTarget& window, Font& font, Clock& animClock);
 
-void drawAnimatedBackground(RenderWindow& window, Clock& bgClock);
+// Degradado y hexagonos flotantes en dos llamadas de dibujo.
+void drawAnimatedBackground(RenderTarget& window, Clock& bgClock);
 
 
 #endif
\ No newline at end of file
@@ -0,0 +1,190 @@
+#include "StaticBoardLayer.hpp"
+#include "DrawCalls.hpp"
+#include "GridMesh.hpp"
+#include "utils/MapLoader.hpp"
+#include <algorithm>
+#include <cmath>
+
+using namespace model;
+using namespace sf;
+
+namespace {
+
+const Color OUTLINE_COLOR(60, 60, 60);
+
+// La textura ya tiene el color multiplicado por su alfa.
+const BlendMode BLEND_PREMULTIPLIED(BlendMode::One, BlendMode::OneMinusSrcAlpha);
+
+}
+
+void StaticBoardLayer::redrawAll(const HexGrid& grid, const HexLayout& layout, const CellRange& region,
+                                 const std::vector<std::uint8_t>& pathMask, const Font& font)
+{
+    m_region = region;
+    m_gridCols = grid.cols();
+
+    float thickness = hexOutlineThickness(layout.hexSize);
+
+    // La textura cubre solo la caja de la region, con el borde exterior de los hexagonos.
+    float extent = std::ceil(layout.hexSize + thickness / 0.8660254f) + 1.0f;
+    Vector2f topLeft = layout.center(region.rowBegin, region.colBegin) - Vector2f(extent, extent);
+    Vector2f bottomRight = layout.center(region.rowEnd - 1, region.colEnd - 1) +
+                           Vector2f(layout.spacingX * 0.5f + extent, extent);
+    m_origin = Vector2f(std::floor(topLeft.x), std::floor(topLeft.y));
+
+    Vector2u size(static_cast<unsigned>(std::ceil(bottomRight.x - m_origin.x)),
+                  static_cast<unsigned>(std::ceil(bottomRight.y - m_origin.y)));
+    if (region.empty()) {
+        size = Vector2u(1, 1);
+    }
+    if (m_texture.getSize() != size) {
+        m_texture.create(size.x, size.y);
+    }
+
+    m_layout = layout;
+    m_layout.offsetX -= m_origin.x;
+    m_layout.offsetY -= m_origin.y;
+
+    std::size_t cells = static_cast<std::size_t>(std::max(0, region.rows())) * std::max(0, region.cols());
+    m_dirty.clear();
+    m_dirtyFlag.assign(cells, 0);
+
+    VertexArray rings(Triangles, cells * GridMesh::OUTLINE_VERTICES);
+    std::size_t i = 0;
+    for (int row = region.rowBegin; row < region.rowEnd; ++row) {
+        for (int col = region.colBegin; col < region.colEnd; ++col, ++i) {
+            writeHexRing(rings, i * GridMesh::OUTLINE_VERTICES, m_layout.center(row, col),
+                         layout.hexSize, thickness, OUTLINE_COLOR);
+        }
+    }
+
+    m_texture.clear(Color::Transparent);
+    drawCounted(m_texture, rings);
+
+    if (layout.hexSize > 8) {
+        configureLabels(font);
+        for (int row = region.rowBegin; row < region.rowEnd; ++row) {
+            for (int col = region.colBegin; col < region.colEnd; ++col) {
+                int cell = grid.index(row, col);
+                if (!pathMask[cell]) {
+                    appendLabel(m_layout.center(row, col), grid.types()[cell]);
+                }
+            }
+        }
+        drawLabels();
+    }
+
+    m_texture.display();
+    m_lastRedraw = cells;
+}
+
+void StaticBoardLayer::markDirty(int cell)
+{
+    int row = cell / m_gridCols, col = cell % m_gridCols;
+    if (!m_region.contains(row, col)) {
+        return;
+    }
+
+    std::size_t local = localIndex(row, col);
+    if (!m_dirtyFlag[local]) {
+        m_dirtyFlag[local] = 1;
+        m_dirty.push_back(cell);
+    }
+}
+
+void StaticBoardLayer::redrawDirty(const HexGrid& grid, const std::vector<std::uint8_t>& pathMask, const Font& font)
+{
+    m_lastRedraw = m_dirty.size();
+    if (m_dirty.empty()) {
+        return;
+    }
+
+    float hexSize = m_layout.hexSize;
+    float thickness = hexOutlineThickness(hexSize);
+
+    // Se borra el hexagono con su borde y un pixel de margen; eso muerde los
+    // bordes vecinos, asi que tambien se vuelven a trazar.
+    VertexArray erase(Triangles, m_dirty.size() * GridMesh::FILL_VERTICES);
+    VertexArray rings(Triangles);
+    std::size_t ring = 0;
+
+    for (std::size_t i = 0; i < m_dirty.size(); ++i) {
+        int cell = m_dirty[i];
+        Vector2f center = m_layout.center(grid.rowOf(cell), grid.colOf(cell));
+        writeHexFill(erase, i * GridMesh::FILL_VERTICES, center, hexSize + thickness / 0.8660254f + 1.0f,
+                     Color::Transparent);
+
+        rings.resize((ring + 7) * GridMesh::OUTLINE_VERTICES);
+        writeHexRing(rings, ring++ * GridMesh::OUTLINE_VERTICES, center, hexSize, thickness, OUTLINE_COLOR);
+        grid.forEachNeighbor(cell, [&](int neighbor) {
+            int row = grid.rowOf(neighbor), col = grid.colOf(neighbor);
+            if (m_region.contains(row, col)) {
+                writeHexRing(rings, ring++ * GridMesh::OUTLINE_VERTICES, m_layout.center(row, col),
+                             hexSize, thickness, OUTLINE_COLOR);
+            }
+        });
+    }
+    rings.resize(ring * GridMesh::OUTLINE_VERTICES);
+
+    drawCounted(m_texture, erase, RenderStates(BlendNone));
+    drawCounted(m_texture, rings);
+
+    if (hexSize > 8) {
+        configureLabels(font);
+        for (int cell : m_dirty) {
+            if (!pathMask[cell]) {
+                appendLabel(m_layout.center(grid.rowOf(cell), grid.colOf(cell)), grid.types()[cell]);
+            }
+        }
+        drawLabels();
+    }
+
+    m_texture.display();
+
+    for (int cell : m_dirty) {
+        m_dirtyFlag[localIndex(grid.rowOf(cell), grid.colOf(cell))] = 0;
+    }
+    m_dirty.clear();
+}
+
+void StaticBoardLayer::configureLabels(const Font& font)
+{
+    float hexSize = m_layout.hexSize;
+    unsigned textSize = static_cast<unsigned>(std::max(10, std::min(static_cast<int>(hexSize * 0.6f), 18)));
+    unsigned wallSize = std::min(textSize + 4, static_cast<unsigned>(hexSize * 0.8f));
+
+    if (!m_glyphs.matches(font, textSize, true)) {
+        m_glyphs.reset(font, textSize, true);
+    }
+    if (!m_wallGlyphs.matches(font, wallSize, true)) {
+        m_wallGlyphs.reset(font, wallSize, true);
+    }
+    m_labels.clear();
+    m_wallLabels.clear();
+}
+
+void StaticBoardLayer::appendLabel(Vector2f center, CellType type)
+{
+    // Hacer las paredes más visibles
+    if (type == CellType::WALL) {
+        m_wallGlyphs.appendLabel(m_wallLabels, CellTypeToString(type), center, Color::White);
+    } else {
+        m_glyphs.appendLabel(m_labels, CellTypeToString(type), center, Color(20, 20, 40));
+    }
+}
+
+void StaticBoardLayer::drawLabels()
+{
+    drawCounted(m_texture, m_labels, RenderStates(&m_glyphs.texture()));
+    drawCounted(m_texture, m_wallLabels, RenderStates(&m_wallGlyphs.texture()));
+}
+
+void StaticBoardLayer::draw(RenderTarget& target, const RenderStates& states) const
+{
+    Sprite sprite(m_texture.getTexture());
+    sprite.setPosition(m_origin);
+
+    RenderStates layerStates(states);
+    layerStates.blendMode = BLEND_PREMULTIPLIED;
+    drawCounted(target, sprite, layerStates);
+}
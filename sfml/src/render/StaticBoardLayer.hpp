@@ -0,0 +1,66 @@
+#ifndef STATIC_BOARD_LAYER_HPP
+#define STATIC_BOARD_LAYER_HPP
+
+#include <SFML/Graphics.hpp>
+#include "GlyphCache.hpp"
+#include "HexLayout.hpp"
+#include "model/HexGrid.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Bordes y etiquetas del tablero cacheados en un RenderTexture.
+ *
+ * Cubre solo las celdas de una region (lo visible mas un margen), con el
+ * layout con el que se armo; BoardRenderer la desplaza con la camara.
+ * Solo se redibujan las celdas marcadas con markDirty: se borra su hexagono y
+ * se vuelven a trazar su borde, los bordes vecinos que pisaba y su etiqueta.
+ * Las etiquetas salen de GlyphCache en un lote por tamano de letra.
+ * La textura guarda alfa premultiplicado para componerse sobre los rellenos.
+ */
+class StaticBoardLayer
+{
+public:
+    void redrawAll(const model::HexGrid& grid, const HexLayout& layout, const CellRange& region,
+                   const std::vector<std::uint8_t>& pathMask, const sf::Font& font);
+
+    // Las celdas fuera de la region se ignoran.
+    void markDirty(int cell);
+
+    void redrawDirty(const model::HexGrid& grid, const std::vector<std::uint8_t>& pathMask, const sf::Font& font);
+
+    void draw(sf::RenderTarget& target, const sf::RenderStates& states) const;
+
+    // Celdas redibujadas en la ultima actualizacion, para el benchmark.
+    std::size_t lastRedrawCount() const { return m_lastRedraw; }
+
+private:
+    std::size_t localIndex(int row, int col) const
+    {
+        return static_cast<std::size_t>(row - m_region.rowBegin) * m_region.cols() + (col - m_region.colBegin);
+    }
+
+    void configureLabels(const sf::Font& font);
+    void appendLabel(sf::Vector2f center, model::CellType type);
+    void drawLabels();
+
+    // Layout relativo a la esquina de la textura, que va en m_origin.
+    HexLayout m_layout;
+    CellRange m_region;
+    int m_gridCols = 1;
+    sf::Vector2f m_origin;
+    sf::RenderTexture m_texture;
+
+    // Las paredes llevan la etiqueta mas grande y en blanco, con su propia pagina de glifos.
+    GlyphCache m_glyphs;
+    GlyphCache m_wallGlyphs;
+    sf::VertexArray m_labels{ sf::Triangles };
+    sf::VertexArray m_wallLabels{ sf::Triangles };
+
+    std::vector<int> m_dirty;
+    std::vector<std::uint8_t> m_dirtyFlag;
+    std::size_t m_lastRedraw = 0;
+};
+
+#endif
@@ -1,5 +1,9 @@
 #include "UIRenderer.hpp"
+#include "DrawCalls.hpp"
 #include "EffectsRenderer.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <initializer_list>
 #include <vector>
 #include <string>
 
@@ -16,6 +20,7 @@ const Color TECH_GRAY = Color(70, 90, 120);
 const Color PATH_RED = Color(255, 50, 50);
 
 void drawModernEnergyBar(RenderWindow& window, const Player& player, Font& font, Clock& animClock) {
+    utils::ScopedTimer timer(utils::FramePhase::Interface);
     const float barWidth = 280.0f;
     const float barHeight = 22.0f;
     const float barX = 25.0f;
@@ -28,7 +33,7 @@ void drawModernEnergyBar(RenderWindow& window, const Player& player, Font& font,
     energyFrame.setFillColor(Color(20, 40, 80, 180));
     energyFrame.setOutlineColor(TECH_GRAY);
     energyFrame.setOutlineThickness(2);
-    window.draw(energyFrame);
+    drawCounted(window, energyFrame);
 
     float fillWidth = barWidth * player.getEnergyPercentage();
     if (fillWidth > 0) {
@@ -55,7 +60,7 @@ void drawModernEnergyBar(RenderWindow& window, const Player& player, Font& font,
         }
 
         energyFill.setFillColor(energyColor);
-        window.draw(energyFill);
+        drawCounted(window, energyFill);
     }
 
     Text energyText;
@@ -65,7 +70,7 @@ void drawModernEnergyBar(RenderWindow& window, const Player& player, Font& font,
     energyText.setStyle(Text::Bold);
     energyText.setString("ENERGIA: " + std::to_string(player.energy) + "/" + std::to_string(Player::MAX_ENERGY));
     energyText.setPosition(barX, barY - 24); // Ajustado por el tamaño mayor
-    window.draw(energyText);
+    drawCounted(window, energyText);
 
     if (player.canUseWallBreak()) {
         float pulse = sin(time * 8.0f) * 0.5f + 0.5f;
@@ -81,7 +86,7 @@ void drawModernEnergyBar(RenderWindow& window, const Player& player, Font& font,
         abilityText.setStyle(Text::Bold);
         abilityText.setString("ESPACIO: DESTRUIR PARED");
         abilityText.setPosition(barX, barY - 46); 
-        window.draw(abilityText);
+        drawCounted(window, abilityText);
     }
     else if (player.isSelectingWall) {
         Text selectText;
@@ -90,7 +95,7 @@ void drawModernEnergyBar(RenderWindow& window, const Player& player, Font& font,
         selectText.setFillColor(NEON_ORANGE);
         selectText.setString("SELECCIONA DIRECCION - ESC: CANCELAR");
         selectText.setPosition(barX, barY - 46);
-        window.draw(selectText);
+        drawCounted(window, selectText);
     }
     else {
         Text waitText;
@@ -99,12 +104,13 @@ void drawModernEnergyBar(RenderWindow& window, const Player& player, Font& font,
         waitText.setFillColor(Color(150, 180, 200));
         waitText.setString("ACUMULA ENERGIA PARA HABILIDADES");
         waitText.setPosition(barX, barY - 46);
-        window.draw(waitText);
+        drawCounted(window, waitText);
     }
 }
 
 void drawGameInfo(RenderWindow& window, Font& font, int turnCount, Clock& animClock,
-                 bool showPathVisualization, bool autoSolveMode) {
+                 bool showPathVisualization, bool autoSolveMode, bool solving) {
+    utils::ScopedTimer timer(utils::FramePhase::Interface);
     float time = animClock.getElapsedTime().asSeconds();
     float windowWidth = static_cast<float>(window.getSize().x);
     
@@ -116,7 +122,7 @@ void drawGameInfo(RenderWindow& window, Font& font, int turnCount, Clock& animCl
     panel.setFillColor(Color(20, 40, 80, 200));
     panel.setOutlineColor(NEON_BLUE);
     panel.setOutlineThickness(2);
-    window.draw(panel);
+    drawCounted(window, panel);
 
     Vector2f corners[] = {
         Vector2f(panelX + 5, panelY + 5),
@@ -138,7 +144,7 @@ void drawGameInfo(RenderWindow& window, Font& font, int turnCount, Clock& animCl
     titleText.setStyle(Text::Bold);
     titleText.setString("ESTADO");
     titleText.setPosition(panelX + 15, panelY + 10);
-    window.draw(titleText);
+    drawCounted(window, titleText);
 
     Text turnText;
     turnText.setFont(font);
@@ -146,7 +152,7 @@ void drawGameInfo(RenderWindow& window, Font& font, int turnCount, Clock& animCl
     turnText.setFillColor(CYBER_WHITE);
     turnText.setString("TURNOS: " + std::to_string(turnCount));
     turnText.setPosition(panelX + 15, panelY + 30);
-    window.draw(turnText);
+    drawCounted(window, turnText);
 
     int turnsUntilWall = 5 - (turnCount % 5);
     Text eventText;
@@ -155,7 +161,7 @@ void drawGameInfo(RenderWindow& window, Font& font, int turnCount, Clock& animCl
     eventText.setFillColor(CYBER_WHITE);
     eventText.setString("PARED: " + std::to_string(turnsUntilWall == 5 ? 0 : turnsUntilWall));
     eventText.setPosition(panelX + 15, panelY + 45);
-    window.draw(eventText);
+    drawCounted(window, eventText);
 
     Text timeText;
     timeText.setFont(font);
@@ -163,7 +169,7 @@ void drawGameInfo(RenderWindow& window, Font& font, int turnCount, Clock& animCl
     timeText.setFillColor(CYBER_WHITE);
     timeText.setString("TIEMPO: " + std::to_string(static_cast<int>(time)) + "S");
     timeText.setPosition(panelX + 15, panelY + 60);
-    window.draw(timeText);
+    drawCounted(window, timeText);
 
     Text modeText;
     modeText.setFont(font);
@@ -171,7 +177,11 @@ void drawGameInfo(RenderWindow& window, Font& font, int turnCount, Clock& animCl
     modeText.setStyle(Text::Bold);
     modeText.setPosition(panelX + 15, panelY + 80);
 
-    if (autoSolveMode && showPathVisualization) {
+    if (solving) {
+        // Hay una busqueda corriendo en segundo plano
+        modeText.setFillColor(ELECTRIC_YELLOW);
+        modeText.setString("MODO: CALCULANDO");
+    } else if (autoSolveMode && showPathVisualization) {
         // Modo: Ejecutando camino mostrado
         modeText.setFillColor(ELECTRIC_YELLOW);
         modeText.setString("MODO: EJECUTANDO");
@@ -188,14 +198,17 @@ void drawGameInfo(RenderWindow& window, Font& font, int turnCount, Clock& animCl
         modeText.setFillColor(NEON_GREEN);
         modeText.setString("MODO: MANUAL");
     }
-    window.draw(modeText);
+    drawCounted(window, modeText);
 
     Text instructionText;
     instructionText.setFont(font);
     instructionText.setCharacterSize(10); // Era 9, ahora 10
     instructionText.setPosition(panelX + 15, panelY + 100);
 
-    if (autoSolveMode && showPathVisualization) {
+    if (solving) {
+        instructionText.setFillColor(ELECTRIC_YELLOW);
+        instructionText.setString("RESOLVIENDO" + std::string(1 + static_cast<int>(time * 3) % 3, '.'));
+    } else if (autoSolveMode && showPathVisualization) {
         instructionText.setFillColor(ELECTRIC_YELLOW);
         instructionText.setString("EJECUTANDO RUTA...");
     } else if (autoSolveMode && !showPathVisualization) {
@@ -208,7 +221,7 @@ void drawGameInfo(RenderWindow& window, Font& font, int turnCount, Clock& animCl
         instructionText.setFillColor(CYBER_WHITE);
         instructionText.setString("P: VISTA PREVIA | R: AUTO");
     }
-    window.draw(instructionText);
+    drawCounted(window, instructionText);
 
     Text optionsText;
     optionsText.setFont(font);
@@ -216,17 +229,18 @@ void drawGameInfo(RenderWindow& window, Font& font, int turnCount, Clock& animCl
     optionsText.setFillColor(Color(150, 180, 200));
     optionsText.setPosition(panelX + 15, panelY + 120);
    
-    if (autoSolveMode) {
+    if (autoSolveMode || solving) {
         optionsText.setString("ESC: PARAR");
     } else if (showPathVisualization) {
         optionsText.setString("T: EJECUTAR | R: DIRECTO");
     } else {
         optionsText.setString("P: MOSTRAR | R: RESOLVER");
     }
-    window.draw(optionsText);
+    drawCounted(window, optionsText);
 }
 
 void drawModernControls(RenderWindow& window, Font& font, Clock& animClock) {
+    utils::ScopedTimer timer(utils::FramePhase::Interface);
     float time = animClock.getElapsedTime().asSeconds();
     float windowWidth = static_cast<float>(window.getSize().x);
     
@@ -238,7 +252,7 @@ void drawModernControls(RenderWindow& window, Font& font, Clock& animClock) {
     controlPanel.setFillColor(Color(20, 40, 80, 200));
     controlPanel.setOutlineColor(NEON_PURPLE);
     controlPanel.setOutlineThickness(2);
-    window.draw(controlPanel);
+    drawCounted(window, controlPanel);
 
     for (int i = 0; i < 4; ++i) {
         float hexX = panelX + 15 + (i % 2) * 30;
@@ -256,7 +270,7 @@ void drawModernControls(RenderWindow& window, Font& font, Clock& animClock) {
     titleText.setStyle(Text::Bold);
     titleText.setString("CONTROLES");
     titleText.setPosition(panelX + 15, panelY + 10);
-    window.draw(titleText);
+    drawCounted(window, titleText);
 
     std::vector<std::string> controls;
     controls.push_back("W/E: ARRIBA");
@@ -267,6 +281,9 @@ void drawModernControls(RenderWindow& window, Font& font, Clock& animClock) {
     controls.push_back("T: EJECUTAR RUTA");  
     controls.push_back("R: AUTO-RESOLVER");      
     controls.push_back("ESC: CANCELAR");
+    controls.push_back("FLECHAS: MOVER VISTA");
+    controls.push_back("RUEDA / + -: ZOOM");
+    controls.push_back("F: SEGUIR / INICIO: MAPA");
 
     for (size_t i = 0; i < controls.size(); ++i) {
         Text controlText;
@@ -288,11 +305,128 @@ void drawModernControls(RenderWindow& window, Font& font, Clock& animClock) {
        
         controlText.setString(controls[i]);
         controlText.setPosition(panelX + 15, panelY + 30 + i * 12);
-        window.draw(controlText);
+        drawCounted(window, controlText);
     }
 
     RectangleShape separator(Vector2f(140, 1));
     separator.setPosition(panelX + 10, panelY + 165);
     separator.setFillColor(Color(NEON_PURPLE.r, NEON_PURPLE.g, NEON_PURPLE.b, 150));
-    window.draw(separator);
-}
\ No newline at end of file
+    drawCounted(window, separator);
+}
+
+namespace {
+
+const Color PHASE_COLORS[utils::FRAME_PHASE_COUNT] = {
+    Color(150, 150, 150),  // eventos
+    Color(0, 255, 150),    // simulacion
+    Color(120, 200, 120),  // validar camino
+    Color(255, 255, 0),    // pathfinding
+    Color(255, 150, 0),    // auto-movimiento
+    Color(70, 90, 120),    // fondo
+    Color(0, 200, 255),    // tablero
+    Color(180, 100, 255),  // interfaz
+    Color(255, 50, 50),    // display
+};
+
+// Escala de la grafica: la altura completa equivale a dos frames de 60 FPS.
+constexpr float GRAPH_HEIGHT = 60.0f;
+constexpr float GRAPH_MAX_MS = 1000.0f / 30.0f;
+constexpr float GRAPH_COLUMN = 2.0f;
+
+void appendRect(VertexArray& batch, float x, float y, float width, float height, Color color) {
+    batch.append(Vertex(Vector2f(x, y), color));
+    batch.append(Vertex(Vector2f(x + width, y), color));
+    batch.append(Vertex(Vector2f(x + width, y + height), color));
+    batch.append(Vertex(Vector2f(x, y), color));
+    batch.append(Vertex(Vector2f(x + width, y + height), color));
+    batch.append(Vertex(Vector2f(x, y + height), color));
+}
+
+float sumPhases(const utils::FrameRecord& record, std::initializer_list<utils::FramePhase> phases) {
+    float total = 0.0f;
+    for (utils::FramePhase phase : phases) {
+        total += record.phaseMs[static_cast<int>(phase)];
+    }
+    return total;
+}
+
+}
+
+void drawProfilerOverlay(RenderWindow& window, Font& font, const utils::Profiler& profiler, double tickRate,
+                         double droppedSeconds) {
+    utils::ScopedTimer timer(utils::FramePhase::Interface);
+    using utils::FramePhase;
+
+    const float panelX = 20.0f;
+    const float panelY = 80.0f;
+    const float panelWidth = utils::Profiler::HISTORY * GRAPH_COLUMN + 20.0f;
+    const unsigned characterSize = 11;
+    const float lineHeight = font.getLineSpacing(characterSize);
+    const float textY = panelY + GRAPH_HEIGHT + 15.0f;
+    const int textLines = 6 + utils::FRAME_PHASE_COUNT;
+
+    std::vector<utils::FrameRecord> history = profiler.history();
+    utils::FrameRecord average = profiler.average();
+
+    // Panel, grafica y leyenda van en un solo lote de triangulos.
+    VertexArray shapes(Triangles);
+    appendRect(shapes, panelX, panelY, panelWidth, textY - panelY + textLines * lineHeight + 8, Color(20, 40, 80, 210));
+
+    float graphX = panelX + 10;
+    float graphBottom = panelY + 10 + GRAPH_HEIGHT;
+    float scale = GRAPH_HEIGHT / GRAPH_MAX_MS;
+    std::size_t firstColumn = utils::Profiler::HISTORY - history.size();
+    for (std::size_t i = 0; i < history.size(); ++i) {
+        float x = graphX + (firstColumn + i) * GRAPH_COLUMN;
+        float y = graphBottom;
+        for (int phase = 0; phase < utils::FRAME_PHASE_COUNT && y > graphBottom - GRAPH_HEIGHT; ++phase) {
+            float height = std::min(history[i].phaseMs[phase] * scale, y - (graphBottom - GRAPH_HEIGHT));
+            if (height > 0.0f) {
+                y -= height;
+                appendRect(shapes, x, y, GRAPH_COLUMN, height, PHASE_COLORS[phase]);
+            }
+        }
+    }
+    appendRect(shapes, graphX, graphBottom - (1000.0f / 60.0f) * scale, utils::Profiler::HISTORY * GRAPH_COLUMN, 1,
+               Color(255, 255, 255, 120));
+
+    for (int phase = 0; phase < utils::FRAME_PHASE_COUNT; ++phase) {
+        appendRect(shapes, panelX + 10, textY + (6 + phase) * lineHeight + 3, 8, 8, PHASE_COLORS[phase]);
+    }
+    drawCounted(window, shapes);
+
+    float updateMs = sumPhases(average, { FramePhase::Simulation, FramePhase::PathValidation,
+                                          FramePhase::Pathfinding, FramePhase::AutoMovement });
+    float renderMs = sumPhases(average, { FramePhase::Background, FramePhase::Board, FramePhase::Interface });
+
+    char line[96];
+    std::string text;
+    std::snprintf(line, sizeof(line), "FRAME: %.2f ms (promedio de %u)\n", average.totalMs,
+                  static_cast<unsigned>(history.size()));
+    text += line;
+    std::snprintf(line, sizeof(line), "UPDATE: %.2f ms  RENDER: %.2f ms\n", updateMs, renderMs);
+    text += line;
+    std::snprintf(line, sizeof(line), "DIBUJOS: %d  TICKS: %.0f/s\n", average.drawCalls, tickRate);
+    text += line;
+    std::snprintf(line, sizeof(line), "SIN SIMULAR: %.2f ms/frame (%.2f s en el mapa)\n",
+                  average.droppedMs, droppedSeconds);
+    text += line;
+    std::uint64_t cacheHits = profiler.pathCacheHits();
+    std::uint64_t cacheLookups = cacheHits + profiler.pathCacheMisses();
+    std::snprintf(line, sizeof(line), "CACHE CAMINOS: %llu aciertos / %llu fallos (%.0f%%)\n",
+                  static_cast<unsigned long long>(cacheHits),
+                  static_cast<unsigned long long>(cacheLookups - cacheHits),
+                  cacheLookups > 0 ? 100.0 * cacheHits / cacheLookups : 0.0);
+    text += line;
+    text += profiler.recordingCsv() ? "F4: DETENER CSV (" + profiler.csvPath() + ")\n" : std::string("F4: GRABAR CSV\n");
+    for (int phase = 0; phase < utils::FRAME_PHASE_COUNT; ++phase) {
+        std::snprintf(line, sizeof(line), "    %-16s %6.2f ms\n",
+                      utils::framePhaseName(static_cast<FramePhase>(phase)), average.phaseMs[phase]);
+        text += line;
+    }
+
+    Text label(text, font, characterSize);
+    label.setFillColor(CYBER_WHITE);
+    label.setPosition(panelX + 10, textY);
+    drawCounted(window, label);
+}
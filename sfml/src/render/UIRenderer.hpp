@@ -3,6 +3,7 @@
 
 #include <SFML/Graphics.hpp>
 #include "model/Player.hpp"
+#include "utils/Profiler.hpp"
 
 using namespace sf;
 using namespace model;
@@ -10,8 +11,12 @@ using namespace model;
 void drawModernEnergyBar(RenderWindow& window, const Player& player, Font& font, Clock& animClock);
 
 void drawGameInfo(RenderWindow& window, Font& font, int turnCount, Clock& animClock,
-                 bool showPathVisualization, bool autoSolveMode);
+                 bool showPathVisualization, bool autoSolveMode, bool solving);
 
 void drawModernControls(RenderWindow& window, Font& font, Clock& animClock);
 
+// Grafica de los ultimos frames por fase, promedios, dibujos por frame y estado del CSV (F3).
+void drawProfilerOverlay(RenderWindow& window, Font& font, const utils::Profiler& profiler, double tickRate,
+                         double droppedSeconds);
+
 #endif
\ No newline at end of file
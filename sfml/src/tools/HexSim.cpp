@@ -0,0 +1,183 @@
+#include "core/Direction.hpp"
+#include "core/GameLogic.hpp"
+#include "core/PathFinding.hpp"
+#include "core/Simulation.hpp"
+#include "utils/MapLoader.hpp"
+#include "utils/Random.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace model;
+
+// Corre muchas partidas sin ventana, repartidas entre varios hilos.
+// Cada partida i usa la semilla base + i, asi el resultado no depende de
+// cuantos hilos se usen.
+
+namespace {
+
+struct SimOptions {
+    std::string mapPath;
+    int games = 1000;
+    int threads = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    std::uint64_t seed = 1;
+    int turnsPerWall = TurnSystem::DEFAULT_TURNS_PER_WALL;
+    int maxSteps = 5000;
+    bool solver = true;
+};
+
+struct GameOutcome {
+    bool won = false;
+    std::uint64_t steps = 0;
+    double virtualSeconds = 0.0;
+};
+
+// Politica "solver": sigue el primer paso del camino optimo y rompe la pared si hace falta.
+core::Action solverAction(core::Simulation& sim, Xoshiro256& rng) {
+    const Player& player = sim.player();
+    PathfindingResult path = findPathIncremental(sim.grid(), player.row, player.col,
+                                                 sim.goalRow(), sim.goalCol(), player.energy);
+
+    if (path.success && path.path.size() >= 2) {
+        const HexCell& next = path.path[1];
+        std::optional<core::Direction> direction =
+            core::directionFromDelta(next.row - player.row, next.col - player.col, player.row);
+
+        if (direction) {
+            if (next.type == CellType::WALL && !player.isSelectingWall) {
+                return core::Action::toggleWallSelect();
+            }
+            return core::Action::move(*direction);
+        }
+    }
+
+    if (player.isSelectingWall) {
+        return core::Action::cancel();
+    }
+    return core::Action::move(static_cast<core::Direction>(rng.below(6)));
+}
+
+GameOutcome playGame(const HexGrid& base, const HexCell& start, const HexCell& goal,
+                     const SimOptions& options, std::uint64_t seed) {
+    core::Simulation sim(base, start.row, start.col, goal.row, goal.col, seed, options.turnsPerWall);
+    Xoshiro256 rng(seed ^ 0xA5A5A5A5A5A5A5A5ULL);
+
+    GameOutcome outcome;
+    while (!sim.finished() && sim.steps() < static_cast<std::uint64_t>(options.maxSteps)) {
+        core::Action action = options.solver
+            ? solverAction(sim, rng)
+            : core::Action::move(static_cast<core::Direction>(rng.below(6)));
+        sim.step(action);
+    }
+
+    outcome.won = sim.finished();
+    outcome.steps = sim.steps();
+    outcome.virtualSeconds = sim.player().winTime;
+    return outcome;
+}
+
+void printUsage() {
+    std::cerr << "Uso: hexsim <mapa> [--partidas N] [--hilos T] [--semilla S] [--turnos-pared K]"
+              << " [--max-pasos M] [--politica solver|aleatoria]" << std::endl;
+}
+
+bool parseOptions(int argc, char* argv[], SimOptions& options) {
+    if (argc < 2) {
+        return false;
+    }
+    options.mapPath = argv[1];
+
+    for (int i = 2; i < argc; ++i) {
+        std::string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (arg == "--partidas" && hasValue) {
+            options.games = std::atoi(argv[++i]);
+        } else if (arg == "--hilos" && hasValue) {
+            options.threads = std::max(1, std::atoi(argv[++i]));
+        } else if (arg == "--semilla" && hasValue) {
+            options.seed = std::strtoull(argv[++i], nullptr, 10);
+        } else if (arg == "--turnos-pared" && hasValue) {
+            options.turnsPerWall = std::atoi(argv[++i]);
+        } else if (arg == "--max-pasos" && hasValue) {
+            options.maxSteps = std::atoi(argv[++i]);
+        } else if (arg == "--politica" && hasValue) {
+            std::string policy = argv[++i];
+            if (policy != "solver" && policy != "aleatoria") {
+                return false;
+            }
+            options.solver = policy == "solver";
+        } else {
+            return false;
+        }
+    }
+    return true;
+}
+
+}
+
+int main(int argc, char* argv[]) {
+    SimOptions options;
+    if (!parseOptions(argc, argv, options)) {
+        printUsage();
+        return 1;
+    }
+
+    HexGrid base = loadHexGridFromFile(options.mapPath);
+    std::optional<HexCell> start = findStartCell(base);
+    std::optional<HexCell> goal = findGoalCell(base);
+    if (!start || !goal) {
+        std::cerr << "El mapa no tiene START y GOAL validos: " << options.mapPath << std::endl;
+        return 1;
+    }
+
+    setGameLogEnabled(false);
+
+    std::vector<GameOutcome> outcomes(options.games);
+    std::atomic<int> nextGame{ 0 };
+
+    auto begin = std::chrono::steady_clock::now();
+
+    std::vector<std::thread> workers;
+    for (int t = 0; t < options.threads; ++t) {
+        workers.emplace_back([&] {
+            for (int game = nextGame++; game < options.games; game = nextGame++) {
+                outcomes[game] = playGame(base, *start, *goal, options, options.seed + game);
+            }
+        });
+    }
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+
+    int wins = 0;
+    std::uint64_t totalSteps = 0;
+    double winSeconds = 0.0;
+    for (const GameOutcome& outcome : outcomes) {
+        totalSteps += outcome.steps;
+        if (outcome.won) {
+            ++wins;
+            winSeconds += outcome.virtualSeconds;
+        }
+    }
+
+    std::cout << "Mapa: " << options.mapPath << " (" << base.rows() << "x" << base.cols() << ")" << std::endl;
+    std::cout << "Partidas: " << options.games << "  Hilos: " << options.threads
+              << "  Politica: " << (options.solver ? "solver" : "aleatoria")
+              << "  Semilla: " << options.seed << std::endl;
+    std::cout << "Victorias: " << wins << " (" << (options.games ? 100.0 * wins / options.games : 0.0) << "%)";
+    if (wins > 0) {
+        std::cout << "  Tiempo virtual medio: " << winSeconds / wins << " s";
+    }
+    std::cout << std::endl;
+    std::cout << "Pasos: " << totalSteps << "  Tiempo real: " << seconds << " s  ("
+              << (seconds > 0.0 ? totalSteps / seconds : 0.0) << " pasos/s)" << std::endl;
+    return 0;
+}
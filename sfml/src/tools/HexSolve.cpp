@@ -0,0 +1,100 @@
+#include "core/AStarSearch.hpp"
+#include "core/DistanceField.hpp"
+#include "core/GameLogic.hpp"
+#include "core/PathFinding.hpp"
+#include "utils/MapLoader.hpp"
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+using namespace model;
+
+// Resuelve un mapa sin abrir ventana e imprime el camino encontrado.
+// Uso: hexsolve <mapa> [--energia N] [--motor astar|incremental|field] [--camino]
+
+static void printUsage() {
+    std::cerr << "Uso: hexsolve <mapa> [--energia N] [--motor astar|incremental|field] [--camino]" << std::endl;
+}
+
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        printUsage();
+        return 1;
+    }
+
+    std::string mapPath = argv[1];
+    std::string engine = "astar";
+    int energy = 0;
+    bool printPath = false;
+
+    for (int i = 2; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--energia" && i + 1 < argc) {
+            energy = std::atoi(argv[++i]);
+        } else if (arg == "--motor" && i + 1 < argc) {
+            engine = argv[++i];
+        } else if (arg == "--camino") {
+            printPath = true;
+        } else {
+            printUsage();
+            return 1;
+        }
+    }
+
+    HexGrid grid = loadHexGridFromFile(mapPath);
+    std::optional<HexCell> start = findStartCell(grid);
+    std::optional<HexCell> goal = findGoalCell(grid);
+    if (!start || !goal) {
+        std::cerr << "El mapa no tiene START y GOAL validos: " << mapPath << std::endl;
+        return 1;
+    }
+
+    auto begin = std::chrono::steady_clock::now();
+    PathfindingResult result;
+    std::size_t expanded = 0;
+
+    if (engine == "astar") {
+        core::AStarSearch search;
+        search.begin(grid, start->row, start->col, goal->row, goal->col, energy);
+        search.run();
+        result = search.result();
+        expanded = search.stats().expanded;
+    } else if (engine == "incremental") {
+        result = findPathIncremental(grid, start->row, start->col, goal->row, goal->col, energy);
+    } else if (engine == "field") {
+        core::DistanceField field;
+        field.begin(grid, goal->row, goal->col);
+        if (field.extendTo(start->row, start->col, energy) == core::SearchStatus::Found) {
+            result = field.path(start->row, start->col, energy);
+        }
+        expanded = field.stats().expanded;
+    } else {
+        printUsage();
+        return 1;
+    }
+
+    double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin).count();
+
+    std::cout << "Mapa: " << mapPath << " (" << grid.rows() << "x" << grid.cols() << ")" << std::endl;
+    std::cout << "Start: (" << start->row << ", " << start->col << ")  Goal: (" << goal->row << ", " << goal->col << ")" << std::endl;
+    std::cout << "Motor: " << engine << "  Tiempo: " << ms << " ms";
+    if (expanded > 0) {
+        std::cout << "  Expandidos: " << expanded;
+    }
+    std::cout << std::endl;
+
+    if (!result.success) {
+        std::cout << "Sin camino hacia la meta." << std::endl;
+        return 2;
+    }
+
+    std::cout << "Camino: " << result.path.size() << " celdas" << std::endl;
+    if (printPath) {
+        for (const HexCell& cell : result.path) {
+            std::cout << "(" << cell.row << ", " << cell.col << ") ";
+        }
+        std::cout << std::endl;
+    }
+    return 0;
+}
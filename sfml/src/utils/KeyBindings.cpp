@@ -0,0 +1,28 @@
+#include "KeyBindings.hpp"
+
+using namespace sf;
+using core::Action;
+using core::Direction;
+
+std::optional<Action> actionFromKey(Keyboard::Key key) {
+    switch (key) {
+        case Keyboard::W:
+            return Action::move(Direction::UpLeft);
+        case Keyboard::E:
+            return Action::move(Direction::UpRight);
+        case Keyboard::A:
+            return Action::move(Direction::Left);
+        case Keyboard::D:
+            return Action::move(Direction::Right);
+        case Keyboard::Z:
+            return Action::move(Direction::DownLeft);
+        case Keyboard::X:
+            return Action::move(Direction::DownRight);
+        case Keyboard::Space:
+            return Action::toggleWallSelect();
+        case Keyboard::Escape:
+            return Action::cancel();
+        default:
+            return std::nullopt;
+    }
+}
@@ -0,0 +1,14 @@
+#ifndef KEYBINDINGS_HPP
+#define KEYBINDINGS_HPP
+
+
+#include <SFML/Window.hpp>
+#include <optional>
+#include "core/Action.hpp"
+
+// Traduce una tecla del juego a una accion de la simulacion:
+// W/E arriba, A/D lados, Z/X abajo, Espacio romper pared, ESC cancelar.
+std::optional<core::Action> actionFromKey(sf::Keyboard::Key key);
+
+
+#endif
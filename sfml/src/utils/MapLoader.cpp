@@ -88,7 +88,7 @@ HexGrid loadHexGridFromFile(const string &filepath)
                 break;
             }
 
-            grid.at(r, c).type = type;
+            grid.setType(r, c, type);
         }
     }
 
@@ -0,0 +1,199 @@
+#include "Profiler.hpp"
+#include <iomanip>
+
+namespace utils {
+
+namespace {
+
+thread_local Profiler* t_current = nullptr;
+
+const char* PHASE_NAMES[FRAME_PHASE_COUNT] = {
+    "eventos",
+    "simulacion",
+    "validar camino",
+    "pathfinding",
+    "auto-movimiento",
+    "fondo",
+    "tablero",
+    "interfaz",
+    "display",
+};
+
+// Nombres de columna del CSV, sin espacios.
+const char* PHASE_COLUMNS[FRAME_PHASE_COUNT] = {
+    "events_ms",
+    "simulation_ms",
+    "path_validation_ms",
+    "pathfinding_ms",
+    "auto_movement_ms",
+    "background_ms",
+    "board_ms",
+    "interface_ms",
+    "display_ms",
+};
+
+}
+
+const char* framePhaseName(FramePhase phase)
+{
+    int index = static_cast<int>(phase);
+    return index >= 0 && index < FRAME_PHASE_COUNT ? PHASE_NAMES[index] : "?";
+}
+
+void Profiler::setCurrent(Profiler* profiler)
+{
+    t_current = profiler;
+}
+
+Profiler* Profiler::current()
+{
+    return t_current;
+}
+
+double Profiler::millisecondsSince(Clock::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+void Profiler::beginFrame()
+{
+    m_frame = FrameRecord();
+    m_frame.frame = m_frameCount;
+    m_open.clear();
+    m_frameStart = Clock::now();
+    m_inFrame = true;
+}
+
+void Profiler::endFrame()
+{
+    if (!m_inFrame) {
+        return;
+    }
+
+    // Una fase que quedo abierta (por ejemplo un return temprano) se cierra aqui.
+    while (!m_open.empty()) {
+        pop();
+    }
+
+    m_frame.totalMs = static_cast<float>(millisecondsSince(m_frameStart));
+    m_inFrame = false;
+    ++m_frameCount;
+
+    m_history[m_historyNext] = m_frame;
+    m_historyNext = (m_historyNext + 1) % HISTORY;
+    if (m_historySize < HISTORY) {
+        ++m_historySize;
+    }
+
+    if (m_csv.is_open()) {
+        writeCsvRow(m_frame);
+    }
+}
+
+bool Profiler::push(FramePhase phase)
+{
+    if (!m_inFrame) {
+        return false;
+    }
+    m_open.push_back(OpenPhase{ phase, Clock::now(), 0.0 });
+    return true;
+}
+
+void Profiler::pop()
+{
+    if (m_open.empty()) {
+        return;
+    }
+
+    OpenPhase open = m_open.back();
+    m_open.pop_back();
+
+    double elapsed = millisecondsSince(open.start);
+    m_frame.phaseMs[static_cast<int>(open.phase)] += static_cast<float>(elapsed - open.childMs);
+    if (!m_open.empty()) {
+        m_open.back().childMs += elapsed;
+    }
+}
+
+bool Profiler::startCsv(const std::string& path)
+{
+    stopCsv();
+
+    m_csv.open(path, std::ios::out | std::ios::trunc);
+    if (!m_csv) {
+        return false;
+    }
+    m_csvPath = path;
+
+    m_csv << "frame,total_ms";
+    for (const char* column : PHASE_COLUMNS) {
+        m_csv << ',' << column;
+    }
+    m_csv << ",draw_calls,ticks,path_cache_hits,path_cache_misses,dropped_ms\n";
+    return true;
+}
+
+void Profiler::stopCsv()
+{
+    if (m_csv.is_open()) {
+        m_csv.close();
+    }
+    m_csvPath.clear();
+}
+
+void Profiler::writeCsvRow(const FrameRecord& record)
+{
+    m_csv << record.frame << ',' << std::fixed << std::setprecision(4) << record.totalMs;
+    for (float ms : record.phaseMs) {
+        m_csv << ',' << ms;
+    }
+    m_csv << ',' << record.drawCalls << ',' << record.ticks
+          << ',' << record.pathCacheHits << ',' << record.pathCacheMisses
+          << ',' << record.droppedMs << '\n';
+}
+
+std::vector<FrameRecord> Profiler::history() const
+{
+    std::vector<FrameRecord> frames;
+    frames.reserve(m_historySize);
+
+    std::size_t first = (m_historyNext + HISTORY - m_historySize) % HISTORY;
+    for (std::size_t i = 0; i < m_historySize; ++i) {
+        frames.push_back(m_history[(first + i) % HISTORY]);
+    }
+    return frames;
+}
+
+FrameRecord Profiler::average() const
+{
+    FrameRecord sum;
+    if (m_historySize == 0) {
+        return sum;
+    }
+
+    double drawCalls = 0.0;
+    double ticks = 0.0;
+    for (std::size_t i = 0; i < m_historySize; ++i) {
+        const FrameRecord& record = m_history[i];
+        sum.totalMs += record.totalMs;
+        sum.droppedMs += record.droppedMs;
+        for (int phase = 0; phase < FRAME_PHASE_COUNT; ++phase) {
+            sum.phaseMs[phase] += record.phaseMs[phase];
+        }
+        drawCalls += record.drawCalls;
+        ticks += record.ticks;
+    }
+
+    float count = static_cast<float>(m_historySize);
+    sum.totalMs /= count;
+    sum.droppedMs /= count;
+    for (float& ms : sum.phaseMs) {
+        ms /= count;
+    }
+    sum.drawCalls = static_cast<int>(drawCalls / count + 0.5);
+    sum.ticks = static_cast<int>(ticks / count + 0.5);
+    sum.frame = m_frameCount;
+    return sum;
+}
+
+}
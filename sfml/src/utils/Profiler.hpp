@@ -0,0 +1,171 @@
+#ifndef PROFILER_HPP
+#define PROFILER_HPP
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace utils {
+
+// Fases en las que se reparte el tiempo de un frame del juego.
+enum class FramePhase
+{
+    Events,
+    Simulation,      // resto de cada tick: bandas, camara, victoria
+    PathValidation,
+    Pathfinding,
+    AutoMovement,
+    Background,
+    Board,
+    Interface,
+    Display,
+    Count
+};
+
+constexpr int FRAME_PHASE_COUNT = static_cast<int>(FramePhase::Count);
+
+const char* framePhaseName(FramePhase phase);
+
+struct FrameRecord
+{
+    std::uint64_t frame = 0;
+    float totalMs = 0.0f;
+    std::array<float, FRAME_PHASE_COUNT> phaseMs{};  // tiempo exclusivo: sin las fases anidadas
+    int drawCalls = 0;
+    int ticks = 0;
+    int pathCacheHits = 0;
+    int pathCacheMisses = 0;
+    float droppedMs = 0.0f;   // tiempo real que FixedTimestep no llego a simular en este frame
+};
+
+/**
+ * @brief Tiempos por fase de cada frame, con historial y exportacion a CSV.
+ *
+ * Los ScopedTimer y las llamadas de dibujo se apuntan al profiler actual
+ * del hilo (setCurrent); en los demas hilos, o sin profiler actual, no
+ * miden nada y cuestan una lectura de una variable thread_local. Asi el
+ * pathfinding de hexsim o de un hilo de fondo no se mezcla con el frame.
+ *
+ * Las fases anidadas se descuentan de la que las contiene (un pathfinding
+ * lanzado al validar el camino no cuenta como validacion), de modo que las
+ * fases de un frame suman como mucho su tiempo total.
+ */
+class Profiler
+{
+public:
+    static constexpr std::size_t HISTORY = 120;
+
+    static void setCurrent(Profiler* profiler);
+    static Profiler* current();
+
+    // Para el contador de dibujos del frame; no hace nada sin profiler actual.
+    static void countDrawCall()
+    {
+        if (Profiler* profiler = current()) {
+            ++profiler->m_frame.drawCalls;
+        }
+    }
+
+    // Consultas a la cache de caminos (core::PathCache), por frame y en total.
+    static void countPathCache(bool hit)
+    {
+        if (Profiler* profiler = current()) {
+            if (hit) {
+                ++profiler->m_frame.pathCacheHits;
+                ++profiler->m_pathCacheHits;
+            } else {
+                ++profiler->m_frame.pathCacheMisses;
+                ++profiler->m_pathCacheMisses;
+            }
+        }
+    }
+
+    std::uint64_t pathCacheHits() const { return m_pathCacheHits; }
+    std::uint64_t pathCacheMisses() const { return m_pathCacheMisses; }
+
+    void beginFrame();
+    void endFrame();
+
+    // push devuelve false fuera de un frame; en ese caso no hay que llamar a pop.
+    bool push(FramePhase phase);
+    void pop();
+
+    void setTicks(int ticks) { m_frame.ticks = ticks; }
+    void setDroppedMs(float ms) { m_frame.droppedMs = ms; }
+
+    // Cada frame terminado se agrega como una fila al archivo hasta stopCsv().
+    bool startCsv(const std::string& path);
+    void stopCsv();
+    bool recordingCsv() const { return m_csv.is_open(); }
+    const std::string& csvPath() const { return m_csvPath; }
+
+    // Frames terminados, del mas antiguo al mas reciente.
+    std::vector<FrameRecord> history() const;
+    FrameRecord average() const;
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct OpenPhase
+    {
+        FramePhase phase;
+        Clock::time_point start;
+        double childMs;
+    };
+
+    static double millisecondsSince(Clock::time_point start);
+
+    void writeCsvRow(const FrameRecord& record);
+
+    FrameRecord m_frame;
+    Clock::time_point m_frameStart;
+    bool m_inFrame = false;
+    std::uint64_t m_frameCount = 0;
+    std::vector<OpenPhase> m_open;
+    std::uint64_t m_pathCacheHits = 0;
+    std::uint64_t m_pathCacheMisses = 0;
+
+    std::array<FrameRecord, HISTORY> m_history{};
+    std::size_t m_historySize = 0;
+    std::size_t m_historyNext = 0;
+
+    std::ofstream m_csv;
+    std::string m_csvPath;
+};
+
+// Mide el bloque actual como `phase` en el profiler del hilo, si hay uno.
+class ScopedTimer
+{
+public:
+    explicit ScopedTimer(FramePhase phase)
+        : m_profiler(Profiler::current())
+    {
+        if (m_profiler && !m_profiler->push(phase)) {
+            m_profiler = nullptr;
+        }
+    }
+
+    ~ScopedTimer() { stop(); }
+
+    // Cierra la fase antes del final del bloque.
+    void stop()
+    {
+        if (m_profiler) {
+            m_profiler->pop();
+            m_profiler = nullptr;
+        }
+    }
+
+    ScopedTimer(const ScopedTimer&) = delete;
+    ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+private:
+    Profiler* m_profiler;
+};
+
+}
+
+#endif
@@ -0,0 +1,76 @@
+#ifndef RANDOM_HPP
+#define RANDOM_HPP
+
+#include <cstdint>
+#include <limits>
+
+/**
+ * @brief Generador xoshiro256** con semilla explicita.
+ *
+ * Rapido, sin estado global y reproducible: dos instancias con la misma
+ * semilla producen la misma secuencia en cualquier hilo o plataforma.
+ * Cumple UniformRandomBitGenerator, asi que sirve con <random>.
+ */
+class Xoshiro256
+{
+public:
+    using result_type = std::uint64_t;
+
+    explicit Xoshiro256(std::uint64_t seed = 0) { reseed(seed); }
+
+    void reseed(std::uint64_t seed)
+    {
+        // splitmix64 expande la semilla a los 256 bits de estado.
+        for (std::uint64_t &word : m_state)
+        {
+            seed += 0x9E3779B97F4A7C15ULL;
+            std::uint64_t z = seed;
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+            word = z ^ (z >> 31);
+        }
+    }
+
+    std::uint64_t next()
+    {
+        const std::uint64_t result = rotl(m_state[1] * 5, 7) * 9;
+        const std::uint64_t t = m_state[1] << 17;
+
+        m_state[2] ^= m_state[0];
+        m_state[3] ^= m_state[1];
+        m_state[1] ^= m_state[2];
+        m_state[0] ^= m_state[3];
+        m_state[2] ^= t;
+        m_state[3] = rotl(m_state[3], 45);
+
+        return result;
+    }
+
+    // Entero uniforme en [0, bound) sin sesgo de modulo (metodo de Lemire).
+    std::uint32_t below(std::uint32_t bound)
+    {
+        std::uint64_t product = static_cast<std::uint64_t>(static_cast<std::uint32_t>(next() >> 32)) * bound;
+        std::uint32_t low = static_cast<std::uint32_t>(product);
+        if (low < bound)
+        {
+            const std::uint32_t threshold = static_cast<std::uint32_t>(-bound) % bound;
+            while (low < threshold)
+            {
+                product = static_cast<std::uint64_t>(static_cast<std::uint32_t>(next() >> 32)) * bound;
+                low = static_cast<std::uint32_t>(product);
+            }
+        }
+        return static_cast<std::uint32_t>(product >> 32);
+    }
+
+    result_type operator()() { return next(); }
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+private:
+    static std::uint64_t rotl(std::uint64_t x, int k) { return (x << k) | (x >> (64 - k)); }
+
+    std::uint64_t m_state[4];
+};
+
+#endif